@@ -0,0 +1,126 @@
+#include "../concurrentListHeader.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// Multi-threaded stress run for concurrentForwardList. Every thread mixes
+// push_front, insert_after and erase_after at the front and at random
+// positions with full scans. Payloads carry a checksum that is wiped on
+// destruction, so a scan that reaches a reclaimed node is detected (build
+// with -fsanitize=address or -fsanitize=thread for stronger checks).
+// Exits with a non-zero status if any check fails.
+//
+//   g++ -std=c++17 -O2 -pthread -o concurrent-stress benchmarks/concurrentListStress.cpp
+//   ./concurrent-stress [threads] [operations per thread]
+
+namespace {
+
+constexpr std::uint64_t kMagic = 0x9e3779b97f4a7c15ULL;
+
+struct Payload {
+    std::uint64_t value;
+    std::uint64_t check;
+
+    explicit Payload(std::uint64_t v) : value(v), check(v ^ kMagic) { }
+    ~Payload() { check = 0; }
+    bool intact() const { return check == (value ^ kMagic); }
+};
+
+struct Tally {
+    std::uint64_t inserted = 0;
+    std::uint64_t erased = 0;
+    std::uint64_t corrupt = 0;
+};
+
+void worker(concurrentForwardList<Payload>& list, unsigned id, std::uint64_t operations, Tally& tally) {
+    std::mt19937_64 rng(id * 7919 + 1);
+    std::uint64_t next = std::uint64_t(id) << 40;
+
+    for (std::uint64_t op = 0; op < operations; ++op) {
+        unsigned choice = rng() % 100;
+        if (choice < 30) {
+            list.emplace_front(next++);
+            ++tally.inserted;
+        }
+        else if (choice < 95) {
+            auto pos = list.cbefore_begin();
+            for (unsigned steps = rng() % 8; steps && pos != list.cend(); --steps) {
+                auto ahead = pos;
+                if (++ahead == list.cend()) {
+                    break;
+                }
+                pos = ahead;
+                if (!pos->intact()) {
+                    ++tally.corrupt;
+                }
+            }
+            if (choice < 45) {
+                if (list.emplace_after(pos, next++)) {
+                    ++tally.inserted;
+                }
+            }
+            else if (list.erase_after(pos)) {
+                ++tally.erased;
+            }
+        }
+        else {
+            for (auto it = list.cbegin(); it != list.cend(); ++it) {
+                if (!it->intact()) {
+                    ++tally.corrupt;
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    unsigned threads = argc > 1 ? unsigned(std::atoi(argv[1])) : std::max(4u, std::thread::hardware_concurrency());
+    std::uint64_t operations = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100000;
+
+    concurrentForwardList<Payload> list;
+    std::vector<Tally> tallies(threads);
+    std::vector<std::thread> pool;
+    for (unsigned id = 0; id < threads; ++id) {
+        pool.emplace_back(worker, std::ref(list), id, operations, std::ref(tallies[id]));
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    Tally total;
+    for (const Tally& tally : tallies) {
+        total.inserted += tally.inserted;
+        total.erased += tally.erased;
+        total.corrupt += tally.corrupt;
+    }
+
+    list.purge();
+    std::uint64_t counted = 0;
+    std::uint64_t duplicates = 0;
+    std::unordered_set<std::uint64_t> seen;
+    for (auto it = list.cbegin(); it != list.cend(); ++it) {
+        ++counted;
+        if (!it->intact()) {
+            ++total.corrupt;
+        }
+        if (!seen.insert(it->value).second) {
+            ++duplicates;
+        }
+    }
+
+    bool ok = total.corrupt == 0 && duplicates == 0 &&
+              counted == total.inserted - total.erased && counted == list.size();
+    std::printf("%u threads x %llu ops: inserted %llu, erased %llu, remaining %llu (size() %zu), "
+                "corrupt reads %llu, duplicates %llu -> %s\n",
+                threads, (unsigned long long)operations, (unsigned long long)total.inserted,
+                (unsigned long long)total.erased, (unsigned long long)counted, list.size(),
+                (unsigned long long)total.corrupt, (unsigned long long)duplicates, ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
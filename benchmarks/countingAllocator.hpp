@@ -0,0 +1,36 @@
+#ifndef COUNTING_ALLOCATOR_H
+#define COUNTING_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+
+// Bytes currently allocated through any countingAllocator
+inline std::size_t g_allocatedBytes = 0;
+
+// std::allocator that records how many bytes are live, so that the node
+// overhead of each container can be measured rather than estimated. The
+// figures exclude malloc's own per-block header, which penalizes the
+// one-node-per-element containers further.
+template <typename T>
+struct countingAllocator {
+    using value_type = T;
+
+    countingAllocator() = default;
+    template <typename U>
+    countingAllocator(const countingAllocator<U>&) { }
+
+    T* allocate(std::size_t n) {
+        g_allocatedBytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) {
+        g_allocatedBytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+    template <typename U>
+    bool operator==(const countingAllocator<U>&) const { return true; }
+    template <typename U>
+    bool operator!=(const countingAllocator<U>&) const { return false; }
+};
+
+#endif
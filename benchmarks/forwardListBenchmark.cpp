@@ -0,0 +1,1005 @@
+#include "../listHeader.hpp"
+#include "../chunkedListHeader.hpp"
+#include "../compactListHeader.hpp"
+#include "../concurrentListHeader.hpp"
+#include "../snapshotHeader.hpp"
+#include "countingAllocator.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <forward_list>
+#include <iterator>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Google Benchmark suite for forwardList (with std::allocator and with
+// poolAllocator), std::forward_list and std::vector, for int, std::string
+// and a 256-byte POD, from 1e2 up to 1e7 elements. Benchmarks are named
+// <operation>/<container>/<element>/<size> and report items per second.
+//
+//   cmake -S . -B build && cmake --build build --target forward-list-benchmark
+//   ./build/forward-list-benchmark --benchmark_filter='iterate/.*/int/'
+//   cmake --build build --target benchmark-json    # whole suite as JSON
+//
+// std::vector has no push_front or emplace_after; it is measured with the
+// nearest idiomatic equivalent (push_back, emplace_back, insert, inplace_merge).
+//
+// The scan_shuffled, scan_compacted and compact benchmarks compare
+// compactForwardList with the pointer-linked lists on lists whose traversal
+// order has been shuffled, and also report bytes_per_element.
+//
+// The chunked_* cases compare chunkedForwardList at three chunk sizes with
+// forwardList and std::forward_list on lists built with push_front, and
+// also report bytes_per_element.
+//
+// The concurrent_* cases run on 1, 2, 4, ... up to hardware_concurrency()
+// threads sharing one list, concurrentForwardList against a forwardList
+// guarded by a std::mutex, and report wall-clock time.
+//
+// The snapshot_* and materialize cases measure saving a forwardList to a
+// snapshot file, opening and scanning it in place with snapshotView, and
+// turning it back into a list; compare them with push_front, which
+// rebuilds the list element by element.
+
+namespace {
+
+// 256-byte trivially copyable element
+struct pod256 {
+    std::uint64_t words[32];
+};
+
+bool operator<(const pod256& lhs, const pod256& rhs) {
+    return lhs.words[0] < rhs.words[0];
+}
+
+// How benchmark elements of each type are named, made and read
+template <typename T>
+struct element;
+
+template <>
+struct element<int> {
+    static constexpr const char* name = "int";
+    static constexpr std::size_t maxSize = 10000000;
+    static int make(std::size_t i) { return static_cast<int>((i * 2654435761u) & 0x7fffffff); }
+    static std::size_t read(const int& value) { return static_cast<std::size_t>(value); }
+};
+
+template <>
+struct element<std::string> {
+    static constexpr const char* name = "string";
+    static constexpr std::size_t maxSize = 10000000;
+    static std::string make(std::size_t i) {
+        // Long enough to defeat the small string optimization
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "element-%010u", static_cast<unsigned>(element<int>::make(i)));
+        return buffer;
+    }
+    static std::size_t read(const std::string& value) { return value.size(); }
+};
+
+template <>
+struct element<pod256> {
+    static constexpr const char* name = "pod256";
+    // 1e7 of these would take several gigabytes per container
+    static constexpr std::size_t maxSize = 1000000;
+    static pod256 make(std::size_t i) {
+        pod256 value;
+        std::fill(std::begin(value.words), std::end(value.words), static_cast<std::uint64_t>(element<int>::make(i)));
+        return value;
+    }
+    static std::size_t read(const pod256& value) { return static_cast<std::size_t>(value.words[0]); }
+};
+
+template <typename T>
+std::vector<T> makeValues(std::size_t count) {
+    std::vector<T> values;
+    values.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        values.push_back(element<T>::make(i));
+    }
+    return values;
+}
+
+// The containers under test and how each spells the operations
+template <typename Container>
+struct ops;
+
+template <typename T>
+struct ops<std::vector<T>> {
+    using container = std::vector<T>;
+
+    static container build(const std::vector<T>& values, const container& like = container()) {
+        container result(like.get_allocator());
+        result.assign(values.begin(), values.end());
+        return result;
+    }
+    static void push_front(container& c, const T& value) { c.push_back(value); }
+    static void emplace_sequence(container& c, const std::vector<T>& values) {
+        for (const T& value : values) {
+            c.emplace_back(value);
+        }
+    }
+    static void insert_range_after_first(container& c, const std::vector<T>& values) {
+        c.insert(c.begin() + 1, values.begin(), values.end());
+    }
+    static void merge(container& c, container& other) {
+        std::size_t middle = c.size();
+        c.insert(c.end(), std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        other.clear();
+        std::inplace_merge(c.begin(), c.begin() + middle, c.end());
+    }
+    static void splice_one(container& to, container& from) {
+        to.push_back(std::move(from.back()));
+        from.pop_back();
+    }
+};
+
+template <typename T>
+struct ops<std::forward_list<T>> {
+    using container = std::forward_list<T>;
+
+    static container build(const std::vector<T>& values, const container& like = container()) {
+        container result(like.get_allocator());
+        result.assign(values.begin(), values.end());
+        return result;
+    }
+    static void push_front(container& c, const T& value) { c.push_front(value); }
+    static void emplace_sequence(container& c, const std::vector<T>& values) {
+        auto it = c.before_begin();
+        for (const T& value : values) {
+            it = c.emplace_after(it, value);
+        }
+    }
+    static void insert_range_after_first(container& c, const std::vector<T>& values) {
+        c.insert_after(c.cbegin(), values.begin(), values.end());
+    }
+    static void merge(container& c, container& other) { c.merge(std::move(other)); }
+    static void splice_one(container& to, container& from) { to.splice_after(to.cbegin(), from, from.cbegin()); }
+};
+
+template <typename T, typename Allocator>
+struct ops<forwardList<T, Allocator>> {
+    using container = forwardList<T, Allocator>;
+
+    static container build(const std::vector<T>& values, const container& like = container()) {
+        container result(like.get_allocator());
+        for (const T& value : values) {
+            result.push_back(value);
+        }
+        return result;
+    }
+    static void push_front(container& c, const T& value) { c.push_front(value); }
+    static void emplace_sequence(container& c, const std::vector<T>& values) {
+        c.emplace_front(values.front());
+        auto it = c.begin();
+        for (std::size_t i = 1; i < values.size(); ++i) {
+            it = c.emplace_after(it, values[i]);
+        }
+    }
+    static void insert_range_after_first(container& c, const std::vector<T>& values) {
+        c.insert_range_after(c.cbegin(), values.begin(), values.end());
+    }
+    static void merge(container& c, container& other) { c.merge(std::move(other)); }
+    static void splice_one(container& to, container& from) { to.splice_after(to.cbegin(), from, from.cbegin()); }
+};
+
+template <typename Container>
+struct containerName;
+
+template <typename T>
+struct containerName<std::vector<T>> {
+    static constexpr const char* value = "std::vector";
+};
+
+template <typename T>
+struct containerName<std::forward_list<T>> {
+    static constexpr const char* value = "std::forward_list";
+};
+
+template <typename T>
+struct containerName<forwardList<T, std::allocator<T>>> {
+    static constexpr const char* value = "forwardList";
+};
+
+template <typename T>
+struct containerName<forwardList<T, poolAllocator<T>>> {
+    static constexpr const char* value = "forwardList+pool";
+};
+
+template <typename Container>
+std::size_t sum(const Container& c) {
+    using T = typename Container::value_type;
+    std::size_t total = 0;
+    for (auto it = c.cbegin(); it != c.cend(); ++it) {
+        total += element<T>::read(*it);
+    }
+    return total;
+}
+
+// How many containers of the given size to keep around before destroying
+// them: enough to amortize pausing the timer, which costs about a
+// microsecond, over many iterations, but at most about 32 MB of elements
+template <typename T>
+std::size_t batchSize(std::int64_t elements) {
+    const std::size_t bytes = static_cast<std::size_t>(elements) * sizeof(T);
+    const std::size_t fits = (std::size_t(32) << 20) / (bytes ? bytes : 1);
+    return std::max<std::size_t>(1, std::min<std::size_t>(256, fits));
+}
+
+// Parks finished containers and destroys them a batch at a time with the
+// timer stopped, so that only the operation itself is measured
+template <typename Container>
+class untimedDisposal {
+public:
+    explicit untimedDisposal(benchmark::State& state)
+        : m_state(state), m_batch(batchSize<typename Container::value_type>(state.range(0))) {
+        m_parked.reserve(m_batch);
+    }
+
+    void dispose(Container& c) {
+        m_parked.push_back(std::move(c));
+        if (m_parked.size() == m_batch) {
+            m_state.PauseTiming();
+            m_parked.clear();
+            m_state.ResumeTiming();
+        }
+    }
+
+private:
+    benchmark::State& m_state;
+    std::size_t m_batch;
+    std::vector<Container> m_parked;
+};
+
+// -----------------------------------------------------------
+// Benchmarks - Each one takes its element count from state.range(0).
+// -----------------------------------------------------------
+template <typename Container>
+void pushFront(benchmark::State& state) {
+    using T = typename Container::value_type;
+    std::vector<T> values = makeValues<T>(state.range(0));
+    untimedDisposal<Container> disposal(state);
+    for (auto _ : state) {
+        Container c;
+        for (const T& value : values) {
+            ops<Container>::push_front(c, value);
+        }
+        benchmark::DoNotOptimize(c);
+        disposal.dispose(c);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void emplaceAfter(benchmark::State& state) {
+    using T = typename Container::value_type;
+    std::vector<T> values = makeValues<T>(state.range(0));
+    untimedDisposal<Container> disposal(state);
+    for (auto _ : state) {
+        Container c;
+        ops<Container>::emplace_sequence(c, values);
+        benchmark::DoNotOptimize(c);
+        disposal.dispose(c);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void insertRangeAfter(benchmark::State& state) {
+    using T = typename Container::value_type;
+    std::vector<T> values = makeValues<T>(state.range(0));
+    std::vector<T> first(1, element<T>::make(0));
+    untimedDisposal<Container> disposal(state);
+    for (auto _ : state) {
+        Container c = ops<Container>::build(first);
+        ops<Container>::insert_range_after_first(c, values);
+        benchmark::DoNotOptimize(c);
+        disposal.dispose(c);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void constructRange(benchmark::State& state) {
+    using T = typename Container::value_type;
+    std::vector<T> values = makeValues<T>(state.range(0));
+    untimedDisposal<Container> disposal(state);
+    for (auto _ : state) {
+        Container c(values.begin(), values.end());
+        benchmark::DoNotOptimize(c);
+        disposal.dispose(c);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void resize(benchmark::State& state) {
+    untimedDisposal<Container> disposal(state);
+    for (auto _ : state) {
+        Container c;
+        c.resize(state.range(0));
+        benchmark::DoNotOptimize(c);
+        disposal.dispose(c);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void copyConstruct(benchmark::State& state) {
+    using T = typename Container::value_type;
+    const Container source = ops<Container>::build(makeValues<T>(state.range(0)));
+    untimedDisposal<Container> disposal(state);
+    for (auto _ : state) {
+        Container copy(source);
+        benchmark::DoNotOptimize(copy);
+        disposal.dispose(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void copyAssign(benchmark::State& state) {
+    using T = typename Container::value_type;
+    std::vector<T> values = makeValues<T>(state.range(0));
+    const Container source = ops<Container>::build(values);
+    std::reverse(values.begin(), values.end());
+    Container target = ops<Container>::build(values);
+    for (auto _ : state) {
+        target = source;
+        benchmark::DoNotOptimize(target);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void merge(benchmark::State& state) {
+    using T = typename Container::value_type;
+    std::vector<T> values = makeValues<T>(state.range(0));
+    std::sort(values.begin(), values.end());
+    std::vector<T> even, odd;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        (i % 2 ? odd : even).push_back(values[i]);
+    }
+    // The inputs are built (and the results destroyed) a batch at a time
+    // with the timer stopped
+    const std::size_t batch = batchSize<T>(state.range(0));
+    std::vector<Container> targets, sources;
+    targets.reserve(batch);
+    sources.reserve(batch);
+    std::size_t next = batch;
+    for (auto _ : state) {
+        if (next == batch) {
+            state.PauseTiming();
+            targets.clear();
+            sources.clear();
+            for (std::size_t i = 0; i < batch; ++i) {
+                targets.push_back(ops<Container>::build(even));
+                sources.push_back(ops<Container>::build(odd, targets.back()));
+            }
+            next = 0;
+            state.ResumeTiming();
+        }
+        ops<Container>::merge(targets[next], sources[next]);
+        benchmark::DoNotOptimize(targets[next]);
+        ++next;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Moves every element but one to the other container, one at a time,
+// and then back again
+template <typename Container>
+void spliceAfter(benchmark::State& state) {
+    using T = typename Container::value_type;
+    Container a = ops<Container>::build(makeValues<T>(state.range(0)));
+    Container b = ops<Container>::build(std::vector<T>(1, element<T>::make(0)), a);
+    std::size_t moves = static_cast<std::size_t>(state.range(0)) - 1;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < moves; ++i) {
+            ops<Container>::splice_one(b, a);
+        }
+        for (std::size_t i = 0; i < moves; ++i) {
+            ops<Container>::splice_one(a, b);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * moves * 2);
+}
+
+template <typename Container>
+void iterate(benchmark::State& state) {
+    using T = typename Container::value_type;
+    const Container c = ops<Container>::build(makeValues<T>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(c));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void registerContainer() {
+    using T = typename Container::value_type;
+    using benchmarkFunction = void (*)(benchmark::State&);
+    struct { const char* name; benchmarkFunction function; } benchmarks[] = {
+        {"push_front", &pushFront<Container>},
+        {"emplace_after", &emplaceAfter<Container>},
+        {"insert_range_after", &insertRangeAfter<Container>},
+        {"construct_range", &constructRange<Container>},
+        {"resize", &resize<Container>},
+        {"copy_construct", &copyConstruct<Container>},
+        {"copy_assign", &copyAssign<Container>},
+        {"merge", &merge<Container>},
+        {"splice_after", &spliceAfter<Container>},
+        {"iterate", &iterate<Container>},
+    };
+    for (const auto& entry : benchmarks) {
+        std::string name = std::string(entry.name) + "/" + containerName<Container>::value + "/" + element<T>::name;
+        benchmark::RegisterBenchmark(name.c_str(), entry.function)
+            ->RangeMultiplier(10)
+            ->Range(100, element<T>::maxSize)
+            ->Unit(benchmark::kMicrosecond);
+    }
+}
+
+template <typename T>
+void registerElement() {
+    registerContainer<std::vector<T>>();
+    registerContainer<std::forward_list<T>>();
+    registerContainer<forwardList<T>>();
+    registerContainer<forwardList<T, poolAllocator<T>>>();
+}
+
+// -----------------------------------------------------------
+// Compact storage - Lists built by inserting after randomly chosen
+// elements, so that traversal order and allocation order disagree
+// as they do in a list that has been edited for a while. They are
+// scanned as they are and, for compactForwardList, after compaction.
+// All of them allocate through countingAllocator, which gives the
+// bytes_per_element counter.
+// -----------------------------------------------------------
+template <typename T>
+struct containerName<std::forward_list<T, countingAllocator<T>>> {
+    static constexpr const char* value = "std::forward_list";
+};
+
+template <typename T>
+struct containerName<forwardList<T, countingAllocator<T>>> {
+    static constexpr const char* value = "forwardList";
+};
+
+template <typename T>
+struct containerName<compactForwardList<T, nodeLayout::arrayOfStructs, countingAllocator<T>>> {
+    static constexpr const char* value = "compactForwardList+aos";
+};
+
+template <typename T>
+struct containerName<compactForwardList<T, nodeLayout::structOfArrays, countingAllocator<T>>> {
+    static constexpr const char* value = "compactForwardList+soa";
+};
+
+// Inserts value after the element at pos and returns the position of the
+// new element, in whatever form each list accepts
+template <typename T, typename A>
+typename std::forward_list<T, A>::iterator insertAfter(std::forward_list<T, A>& list, typename std::forward_list<T, A>::iterator pos, const T& value) {
+    return list.insert_after(pos, value);
+}
+
+template <typename T, typename A>
+Node<T>* insertAfter(forwardList<T, A>& list, Node<T>* pos, const T& value) {
+    list.insert_after(pos, value);
+    typename forwardList<T, A>::iterator it(pos);
+    return (++it).data;
+}
+
+template <typename T, nodeLayout L, typename A>
+typename compactForwardList<T, L, A>::const_iterator insertAfter(compactForwardList<T, L, A>& list, typename compactForwardList<T, L, A>::const_iterator pos, const T& value) {
+    return list.insert_after(pos, value);
+}
+
+template <typename T, typename A>
+typename std::forward_list<T, A>::iterator firstPosition(std::forward_list<T, A>& list) {
+    return list.begin();
+}
+
+template <typename T, typename A>
+Node<T>* firstPosition(forwardList<T, A>& list) {
+    return list.begin().data;
+}
+
+template <typename T, nodeLayout L, typename A>
+typename compactForwardList<T, L, A>::const_iterator firstPosition(compactForwardList<T, L, A>& list) {
+    return list.cbegin();
+}
+
+template <typename List>
+List buildShuffled(std::size_t count) {
+    using T = typename List::value_type;
+    std::mt19937 random(42);
+    List list;
+    list.push_front(element<T>::make(0));
+    std::vector<decltype(firstPosition(list))> positions{firstPosition(list)};
+    positions.reserve(count);
+    for (std::size_t i = 1; i < count; ++i) {
+        positions.push_back(insertAfter(list, positions[random() % positions.size()], element<T>::make(i)));
+    }
+    return list;
+}
+
+template <typename List>
+void scanShuffled(benchmark::State& state) {
+    std::size_t before = g_allocatedBytes;
+    const List list = buildShuffled<List>(state.range(0));
+    state.counters["bytes_per_element"] = double(g_allocatedBytes - before) / double(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(list));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void scanCompacted(benchmark::State& state) {
+    std::size_t before = g_allocatedBytes;
+    List list = buildShuffled<List>(state.range(0));
+    list.shrink_to_fit();
+    state.counters["bytes_per_element"] = double(g_allocatedBytes - before) / double(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(list));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Renumbers shuffled lists, built a batch at a time with the timer stopped
+template <typename List>
+void compactList(benchmark::State& state) {
+    using T = typename List::value_type;
+    const std::size_t batch = batchSize<T>(state.range(0));
+    std::vector<List> lists;
+    lists.reserve(batch);
+    std::size_t next = batch;
+    for (auto _ : state) {
+        if (next == batch) {
+            state.PauseTiming();
+            lists.clear();
+            for (std::size_t i = 0; i < batch; ++i) {
+                lists.push_back(buildShuffled<List>(state.range(0)));
+            }
+            next = 0;
+            state.ResumeTiming();
+        }
+        lists[next].compact();
+        benchmark::DoNotOptimize(lists[next]);
+        ++next;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void registerShuffled(const char* operation, void (*function)(benchmark::State&)) {
+    using T = typename List::value_type;
+    std::string name = std::string(operation) + "/" + containerName<List>::value + "/" + element<T>::name;
+    // Building a shuffled list is slow, so stop at 1e6 elements
+    benchmark::RegisterBenchmark(name.c_str(), function)
+        ->RangeMultiplier(10)
+        ->Range(100, std::min<std::size_t>(element<T>::maxSize, 1000000))
+        ->Unit(benchmark::kMicrosecond);
+}
+
+template <typename T>
+void registerCompactStorage() {
+    using aos = compactForwardList<T, nodeLayout::arrayOfStructs, countingAllocator<T>>;
+    using soa = compactForwardList<T, nodeLayout::structOfArrays, countingAllocator<T>>;
+    registerShuffled<std::forward_list<T, countingAllocator<T>>>("scan_shuffled", &scanShuffled<std::forward_list<T, countingAllocator<T>>>);
+    registerShuffled<forwardList<T, countingAllocator<T>>>("scan_shuffled", &scanShuffled<forwardList<T, countingAllocator<T>>>);
+    registerShuffled<aos>("scan_shuffled", &scanShuffled<aos>);
+    registerShuffled<soa>("scan_shuffled", &scanShuffled<soa>);
+    registerShuffled<aos>("scan_compacted", &scanCompacted<aos>);
+    registerShuffled<soa>("scan_compacted", &scanCompacted<soa>);
+    registerShuffled<aos>("compact", &compactList<aos>);
+    registerShuffled<soa>("compact", &compactList<soa>);
+}
+
+// -----------------------------------------------------------
+// Chunked benchmarks - Lists built with push_front, as a queue or
+// stack would build them, then scanned or emptied from the front.
+// Lists allocate through countingAllocator, which gives the
+// bytes_per_element counter.
+// -----------------------------------------------------------
+template <typename T, std::size_t N>
+struct containerName<chunkedForwardList<T, N, countingAllocator<T>>> {
+    static inline const std::string value = "chunkedForwardList+" + std::to_string(N);
+};
+
+template <typename T, std::size_t N, typename A>
+typename chunkedForwardList<T, N, A>::const_iterator firstPosition(chunkedForwardList<T, N, A>& list) {
+    return list.cbegin();
+}
+
+// Registers operation/<container>/<element> from 1e2 up to 1e6 elements
+template <typename Container>
+void registerUpToMillion(const char* operation, void (*function)(benchmark::State&)) {
+    using T = typename Container::value_type;
+    std::string name = std::string(operation) + "/" + containerName<Container>::value + "/" + element<T>::name;
+    benchmark::RegisterBenchmark(name.c_str(), function)
+        ->RangeMultiplier(10)
+        ->Range(100, std::min<std::size_t>(element<T>::maxSize, 1000000))
+        ->Unit(benchmark::kMicrosecond);
+}
+
+template <typename List>
+List buildFront(const std::vector<typename List::value_type>& values) {
+    List list;
+    for (const auto& value : values) {
+        list.push_front(value);
+    }
+    return list;
+}
+
+template <typename List>
+void chunkedScan(benchmark::State& state) {
+    using T = typename List::value_type;
+    std::size_t before = g_allocatedBytes;
+    const List list = buildFront<List>(makeValues<T>(state.range(0)));
+    state.counters["bytes_per_element"] = double(g_allocatedBytes - before) / double(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(list));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void chunkedPushFront(benchmark::State& state) {
+    using T = typename List::value_type;
+    std::vector<T> values = makeValues<T>(state.range(0));
+    std::size_t before = g_allocatedBytes;
+    {
+        List list = buildFront<List>(values);
+        state.counters["bytes_per_element"] = double(g_allocatedBytes - before) / double(state.range(0));
+    }
+    untimedDisposal<List> disposal(state);
+    for (auto _ : state) {
+        List list = buildFront<List>(values);
+        benchmark::DoNotOptimize(list);
+        disposal.dispose(list);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Erases all but the first element, one erase_after(first) at a time,
+// from lists built a batch at a time with the timer stopped
+template <typename List>
+void chunkedEraseFront(benchmark::State& state) {
+    using T = typename List::value_type;
+    std::vector<T> values = makeValues<T>(state.range(0));
+    const std::size_t batch = batchSize<T>(state.range(0));
+    std::vector<List> lists;
+    lists.reserve(batch);
+    std::size_t next = batch;
+    for (auto _ : state) {
+        if (next == batch) {
+            state.PauseTiming();
+            lists.clear();
+            for (std::size_t i = 0; i < batch; ++i) {
+                lists.push_back(buildFront<List>(values));
+            }
+            next = 0;
+            state.ResumeTiming();
+        }
+        List& list = lists[next];
+        for (std::size_t i = 1; i < values.size(); ++i) {
+            list.erase_after(firstPosition(list));
+        }
+        benchmark::DoNotOptimize(list);
+        ++next;
+    }
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 1));
+}
+
+template <typename List>
+void registerChunkedCases() {
+    registerUpToMillion<List>("chunked_scan", &chunkedScan<List>);
+    registerUpToMillion<List>("chunked_push_front", &chunkedPushFront<List>);
+    registerUpToMillion<List>("chunked_erase_front", &chunkedEraseFront<List>);
+}
+
+template <typename T>
+void registerChunked() {
+    registerChunkedCases<std::forward_list<T, countingAllocator<T>>>();
+    registerChunkedCases<forwardList<T, countingAllocator<T>>>();
+    registerChunkedCases<chunkedForwardList<T, 8, countingAllocator<T>>>();
+    registerChunkedCases<chunkedForwardList<T, 16, countingAllocator<T>>>();
+    registerChunkedCases<chunkedForwardList<T, 64, countingAllocator<T>>>();
+}
+
+// -----------------------------------------------------------
+// Concurrent benchmarks - All threads of a run share one list, which
+// thread 0 creates before the timed loop and destroys after it (the
+// loop starts and ends with a barrier). Each iteration inserts at the
+// front, erases the front element, or finds the element 32 deep.
+// -----------------------------------------------------------
+
+// forwardList has no before_begin(), so the first node serves as a fixed
+// sentinel and the front of the list is the position right after it.
+struct lockedList {
+    using value_type = long;
+
+    forwardList<long> list;
+    std::mutex mutex;
+
+    lockedList() {
+        list.push_front(0);
+    }
+    void push_front(long value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        list.insert_after(list.begin().data, value);
+    }
+    void pop_front() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (list.size() > 1) {
+            list.erase_after(list.begin().data);
+        }
+    }
+    bool find(long value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = ++list.begin(); it != list.end(); ++it) {
+            if (*it == value) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+struct lockFreeList {
+    using value_type = long;
+
+    concurrentForwardList<long> list;
+
+    void push_front(long value) {
+        list.push_front(value);
+    }
+    void pop_front() {
+        list.erase_after(list.cbefore_begin());
+    }
+    bool find(long value) {
+        for (auto it = list.cbegin(); it != list.cend(); ++it) {
+            if (*it == value) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+template <>
+struct containerName<lockedList> {
+    static constexpr const char* value = "forwardList+mutex";
+};
+
+template <>
+struct containerName<lockFreeList> {
+    static constexpr const char* value = "concurrentForwardList";
+};
+
+// The list shared by the threads of the running benchmark
+template <typename List>
+List* g_sharedList = nullptr;
+
+template <typename List>
+void concurrentInsert(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_sharedList<List> = new List();
+    }
+    long value = 0;
+    for (auto _ : state) {
+        g_sharedList<List>->push_front(value++);
+    }
+    if (state.thread_index() == 0) {
+        delete g_sharedList<List>;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Each thread pushes a batch of elements with its timer stopped before
+// erasing as many, so the list never runs empty however many
+// iterations the run takes
+template <typename List>
+void concurrentErase(benchmark::State& state) {
+    constexpr long batch = 1024;
+    if (state.thread_index() == 0) {
+        g_sharedList<List> = new List();
+    }
+    long pending = 0;
+    for (auto _ : state) {
+        if (pending == 0) {
+            state.PauseTiming();
+            for (long i = 0; i < batch; ++i) {
+                g_sharedList<List>->push_front(i);
+            }
+            pending = batch;
+            state.ResumeTiming();
+        }
+        g_sharedList<List>->pop_front();
+        --pending;
+    }
+    if (state.thread_index() == 0) {
+        delete g_sharedList<List>;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename List>
+void concurrentFind(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_sharedList<List> = new List();
+        for (long i = 0; i < 1000; ++i) {
+            g_sharedList<List>->push_front(i);
+        }
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(g_sharedList<List>->find(1000 - 32));
+    }
+    if (state.thread_index() == 0) {
+        delete g_sharedList<List>;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename List>
+void registerConcurrentCases() {
+    const int maxThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    const std::pair<const char*, void (*)(benchmark::State&)> cases[] = {
+        {"concurrent_insert", &concurrentInsert<List>},
+        {"concurrent_erase", &concurrentErase<List>},
+        {"concurrent_find", &concurrentFind<List>},
+    };
+    for (const auto& entry : cases) {
+        std::string name = std::string(entry.first) + "/" + containerName<List>::value + "/long";
+        benchmark::RegisterBenchmark(name.c_str(), entry.second)
+            ->ThreadRange(1, maxThreads)
+            ->UseRealTime()
+            ->Unit(benchmark::kMicrosecond);
+    }
+}
+
+void registerConcurrent() {
+    registerConcurrentCases<lockedList>();
+    registerConcurrentCases<lockFreeList>();
+}
+
+// -----------------------------------------------------------
+// Snapshot benchmarks - Each one saves a list of state.range(0)
+// elements to a temporary snapshot file, works on that file and
+// removes it afterwards. The lists built from a snapshot allocate
+// through countingAllocator, which gives the bytes_per_element
+// counter, or through poolAllocator, whose slab it cannot see.
+// -----------------------------------------------------------
+template <typename T>
+struct containerName<snapshotView<T>> {
+    static constexpr const char* value = "snapshotView";
+};
+
+// A snapshot of state.range(0) elements, removed when it goes out of scope
+template <typename T>
+class snapshotFile {
+public:
+    explicit snapshotFile(const benchmark::State& state)
+        : m_path((std::filesystem::temp_directory_path() /
+                  ("forwardListBenchmark-" + std::string(element<T>::name) + "-" + std::to_string(state.range(0)) + ".bin")).string()) {
+        forwardList<T> list;
+        for (const T& value : makeValues<T>(state.range(0))) {
+            list.push_front(value);
+        }
+        saveSnapshot(list, m_path);
+    }
+    ~snapshotFile() { std::remove(m_path.c_str()); }
+    snapshotFile(const snapshotFile&) = delete;
+    snapshotFile& operator=(const snapshotFile&) = delete;
+
+    const std::string& path() const { return m_path; }
+
+private:
+    std::string m_path;
+};
+
+template <typename T>
+void snapshotSave(benchmark::State& state) {
+    snapshotFile<T> file(state);
+    forwardList<T> list;
+    loadSnapshot(list, file.path());
+    for (auto _ : state) {
+        saveSnapshot(list, file.path());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void snapshotOpen(benchmark::State& state) {
+    snapshotFile<T> file(state);
+    for (auto _ : state) {
+        snapshotView<T> view(file.path());
+        benchmark::DoNotOptimize(view);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void snapshotScan(benchmark::State& state) {
+    snapshotFile<T> file(state);
+    snapshotView<T> view(file.path());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(view));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void materialize(benchmark::State& state) {
+    using T = typename List::value_type;
+    snapshotFile<T> file(state);
+    snapshotView<T> view(file.path());
+    if (std::is_same<typename List::allocator_type, countingAllocator<T>>::value) {
+        std::size_t before = g_allocatedBytes;
+        List list = view.template materialize<typename List::allocator_type>();
+        state.counters["bytes_per_element"] = double(g_allocatedBytes - before) / double(state.range(0));
+    }
+    untimedDisposal<List> disposal(state);
+    for (auto _ : state) {
+        List list = view.template materialize<typename List::allocator_type>();
+        benchmark::DoNotOptimize(list);
+        disposal.dispose(list);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void snapshotLoad(benchmark::State& state) {
+    using T = typename List::value_type;
+    snapshotFile<T> file(state);
+    untimedDisposal<List> disposal(state);
+    for (auto _ : state) {
+        List list;
+        loadSnapshot(list, file.path());
+        benchmark::DoNotOptimize(list);
+        disposal.dispose(list);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void registerSnapshots() {
+    registerUpToMillion<snapshotView<T>>("snapshot_save", &snapshotSave<T>);
+    registerUpToMillion<snapshotView<T>>("snapshot_open", &snapshotOpen<T>);
+    registerUpToMillion<snapshotView<T>>("snapshot_scan", &snapshotScan<T>);
+    registerUpToMillion<forwardList<T, countingAllocator<T>>>("materialize", &materialize<forwardList<T, countingAllocator<T>>>);
+    registerUpToMillion<forwardList<T, poolAllocator<T>>>("materialize", &materialize<forwardList<T, poolAllocator<T>>>);
+    registerUpToMillion<forwardList<T, countingAllocator<T>>>("snapshot_load", &snapshotLoad<forwardList<T, countingAllocator<T>>>);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    registerElement<int>();
+    registerElement<std::string>();
+    registerElement<pod256>();
+    registerCompactStorage<int>();
+    registerCompactStorage<pod256>();
+    registerChunked<int>();
+    registerChunked<pod256>();
+    registerConcurrent();
+    registerSnapshots<int>();
+    registerSnapshots<pod256>();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
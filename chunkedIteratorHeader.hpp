@@ -0,0 +1,48 @@
+#ifndef CHUNKED_ITERATOR_H
+#define CHUNKED_ITERATOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+template <typename T, std::size_t N>
+class ChunkNode;
+
+template <typename T, std::size_t N, typename Allocator>
+class chunkedForwardList;
+
+// Forward iterator over a chunkedForwardList. It addresses an element by
+// the chunk holding it and the element's index inside that chunk.
+template <typename T, std::size_t N>
+class ChunkIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_const<T>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+    using node_type = ChunkNode<typename std::remove_const<T>::type, N>;
+
+    ChunkIterator();
+    ChunkIterator(node_type*, std::size_t);
+
+    template <typename U, typename = typename std::enable_if<std::is_same<const U, T>::value && !std::is_same<U, T>::value>::type>
+    ChunkIterator(const ChunkIterator<U, N>&);
+
+    reference operator*() const;
+    pointer operator->() const;
+    ChunkIterator& operator++();
+    ChunkIterator operator++(int);
+    bool operator==(const ChunkIterator&) const;
+    bool operator!=(const ChunkIterator&) const;
+
+    template <typename, std::size_t, typename>
+    friend class chunkedForwardList;
+public:
+    node_type* data;
+    std::size_t index;
+};
+
+#include "chunkedIteratorImplementation.tpp"
+
+#endif
\ No newline at end of file
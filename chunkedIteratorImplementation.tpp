@@ -0,0 +1,99 @@
+#include "chunkedIteratorHeader.hpp"
+
+/**
+ * @brief Default constructor for ChunkIterator class.
+ *
+ * Initializes the iterator with a null chunk, which is also the end position.
+ */
+template <typename T, std::size_t N>
+ChunkIterator<T, N>::ChunkIterator() : data(nullptr), index(0) { }
+
+/**
+ * @brief Constructor for ChunkIterator class that points at one element of a chunk.
+ *
+ * @param p A pointer to the chunk holding the element.
+ * @param i The index of the element inside the chunk.
+ */
+template <typename T, std::size_t N>
+ChunkIterator<T, N>::ChunkIterator(node_type* p, std::size_t i) : data(p), index(i) { }
+
+/**
+ * @brief Converting constructor from a mutable iterator to a constant one.
+ *
+ * @param other The mutable iterator pointing to the same element.
+ */
+template <typename T, std::size_t N>
+template <typename U, typename>
+ChunkIterator<T, N>::ChunkIterator(const ChunkIterator<U, N>& other) : data(other.data), index(other.index) { }
+
+/**
+ * @brief Dereference operator to access the element the iterator is pointing to.
+ *
+ * @return reference A reference to the element.
+ */
+template <typename T, std::size_t N>
+typename ChunkIterator<T, N>::reference ChunkIterator<T, N>::operator*() const {
+    return *data->slot(index);
+}
+
+/**
+ * @brief Arrow operator to access the element the iterator is pointing to.
+ *
+ * @return pointer A pointer to the element.
+ */
+template <typename T, std::size_t N>
+typename ChunkIterator<T, N>::pointer ChunkIterator<T, N>::operator->() const {
+    return data->slot(index);
+}
+
+/**
+ * @brief Pre-increment operator to move the iterator forward.
+ *
+ * Advances to the next element of the same chunk, and only follows the
+ * chunk's next pointer once the chunk is exhausted.
+ *
+ * @return ChunkIterator& A reference to the current iterator, after advancing.
+ */
+template <typename T, std::size_t N>
+ChunkIterator<T, N>& ChunkIterator<T, N>::operator++() {
+    if (data && ++index == data->m_count) {
+        data = data->m_next;  // Move to the next chunk.
+        index = 0;
+    }
+    return *this;
+}
+
+/**
+ * @brief Post-increment operator to move the iterator forward.
+ *
+ * @param int Placeholder for the post-increment syntax.
+ * @return ChunkIterator A copy of the iterator before it was incremented.
+ */
+template <typename T, std::size_t N>
+ChunkIterator<T, N> ChunkIterator<T, N>::operator++(int) {
+    ChunkIterator tmp = *this;
+    ++(*this);
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for iterators.
+ *
+ * @param other The iterator to compare with the current one.
+ * @return bool True if both iterators point to the same element, otherwise false.
+ */
+template <typename T, std::size_t N>
+bool ChunkIterator<T, N>::operator==(const ChunkIterator& other) const {
+    return data == other.data && index == other.index;
+}
+
+/**
+ * @brief Inequality comparison operator for iterators.
+ *
+ * @param other The iterator to compare with the current one.
+ * @return bool True if both iterators point to different elements, otherwise false.
+ */
+template <typename T, std::size_t N>
+bool ChunkIterator<T, N>::operator!=(const ChunkIterator& other) const {
+    return !(*this == other);
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#ifndef CHUNKED_LIST_H
+#define CHUNKED_LIST_H
+
+#include "chunkedIteratorHeader.hpp"
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+template <typename T, std::size_t N = 16, typename Allocator = std::allocator<T>>
+class chunkedForwardList;
+
+// One link of an unrolled list: up to N elements stored contiguously,
+// followed by the link to the next chunk. Elements [0, m_count) are alive.
+template <typename T, std::size_t N>
+class ChunkNode {
+    static_assert(N > 0, "A chunk must hold at least one element");
+private:
+    ChunkNode* m_next;
+    std::size_t m_count;
+    alignas(T) unsigned char m_storage[N * sizeof(T)];
+
+    T* slot(std::size_t);
+    const T* slot(std::size_t) const;
+public:
+    ChunkNode();
+
+    template <typename, std::size_t, typename>
+    friend class chunkedForwardList;
+    friend class ChunkIterator<T, N>;
+    friend class ChunkIterator<const T, N>;
+};
+
+// Unrolled singly linked list: the same iterator-based interface as
+// forwardList, but each node holds up to N elements, so a scan touches
+// one pointer per N elements instead of one per element. Inserting into
+// a full chunk splits it in half; erasing merges sparse neighbours.
+// Insertions and erasures may move elements between chunks and thus
+// invalidate iterators into the affected chunks.
+template <typename T, std::size_t N, typename Allocator>
+class chunkedForwardList {
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using iterator = ChunkIterator<T, N>;
+    using const_iterator = ChunkIterator<const T, N>;
+
+public:
+    chunkedForwardList();
+    explicit chunkedForwardList(const Allocator&);
+    chunkedForwardList(size_type, const T&, const Allocator& = Allocator());
+    ~chunkedForwardList();
+    chunkedForwardList(const chunkedForwardList&);
+    chunkedForwardList(chunkedForwardList&&) noexcept;
+    chunkedForwardList& operator=(const chunkedForwardList&);
+    chunkedForwardList& operator=(chunkedForwardList&&);
+
+    template <typename... Args>
+    iterator emplace_after(const_iterator, Args&&...);
+    iterator insert_after(const_iterator, const T&);
+    iterator insert_after(const_iterator, T&&);
+
+    template <typename InputIt>
+    iterator insert_range_after(const_iterator, InputIt, InputIt);
+
+    void erase_after(const_iterator);
+    void push_front(const T&);
+    void push_front(T&&);
+
+    template <typename... Args>
+    void emplace_front(Args&&...);
+
+    void swap(chunkedForwardList&);
+    iterator begin();
+    iterator end();
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    bool empty() const;
+    size_type size() const noexcept;
+    size_type chunk_count() const noexcept;
+    void clear();
+    allocator_type get_allocator() const;
+
+private:
+    using chunk_type = ChunkNode<T, N>;
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<chunk_type>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    // Elements are moved between slots, or copied if T cannot be moved
+    using relocated_type = typename std::conditional<std::is_move_constructible<T>::value, T&&, const T&>::type;
+    static constexpr bool s_nothrowRelocate = std::is_nothrow_constructible<T, relocated_type>::value;
+
+    static relocated_type relocate(T&) noexcept;
+
+    template <typename... Args>
+    static bool points_into(const chunk_type*, const Args&...) noexcept;
+
+    chunk_type* create_chunk();
+    void destroy_chunk(chunk_type*);
+    chunk_type* split(chunk_type*, size_type);
+    iterator make_room(const_iterator);
+    void drop_if_empty(const_iterator, chunk_type*) noexcept;
+
+    template <typename... Args>
+    void insert_at(chunk_type*, size_type, Args&&...);
+    void erase_at(chunk_type*, chunk_type*, size_type);
+    void merge_with_next(chunk_type*);
+    void copy_chunks(const chunkedForwardList&);
+    void steal(chunkedForwardList&) noexcept;
+
+    chunk_type* m_head;
+    node_allocator m_alloc;
+    size_type m_size = 0;
+    size_type m_chunks = 0;
+};
+
+#include "chunkedListImplementation.tpp"
+
+#endif
\ No newline at end of file
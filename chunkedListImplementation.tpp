@@ -0,0 +1,670 @@
+#include "chunkedListHeader.hpp"
+
+// -----------------------------------------------------------
+// ChunkNode Constructor - Creates an empty chunk that is not
+// linked to any other chunk. The element storage stays raw until
+// elements are constructed into it.
+// -----------------------------------------------------------
+template <typename T, std::size_t N>
+ChunkNode<T, N>::ChunkNode() : m_next(nullptr), m_count(0) { }
+
+
+// -----------------------------------------------------------
+// slot - Returns a pointer to the i-th element slot of the chunk.
+// -----------------------------------------------------------
+template <typename T, std::size_t N>
+T* ChunkNode<T, N>::slot(std::size_t i) {
+    return std::launder(reinterpret_cast<T*>(m_storage) + i);
+}
+
+template <typename T, std::size_t N>
+const T* ChunkNode<T, N>::slot(std::size_t i) const {
+    return std::launder(reinterpret_cast<const T*>(m_storage) + i);
+}
+
+
+// -----------------------------------------------------------
+// chunkedForwardList Constructor (Default) - Initializes an empty
+// list with no chunks.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+chunkedForwardList<T, N, Allocator>::chunkedForwardList() : m_head(nullptr), m_alloc() { }
+
+
+// -----------------------------------------------------------
+// chunkedForwardList Constructor (Allocator) - Initializes an empty
+// list whose chunks will be obtained from the given allocator.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+chunkedForwardList<T, N, Allocator>::chunkedForwardList(const Allocator& alloc) : m_head(nullptr), m_alloc(alloc) { }
+
+
+// -----------------------------------------------------------
+// chunkedForwardList Constructor (Count and Value) - Creates a list
+// of count copies of value, packed into full chunks.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+chunkedForwardList<T, N, Allocator>::chunkedForwardList(size_type count, const T& value, const Allocator& alloc)
+    : m_head(nullptr), m_alloc(alloc) {
+    if (count) {
+        try {
+            m_head = create_chunk();
+            chunk_type* tail = m_head;
+            for (size_type i = 0; i < count; ++i) {
+                if (tail->m_count == N) {
+                    tail->m_next = create_chunk();
+                    tail = tail->m_next;
+                }
+                ::new (static_cast<void*>(tail->slot(tail->m_count))) T(value);
+                ++tail->m_count;
+                ++m_size;
+            }
+        }
+        catch (...) {
+            clear();
+            throw;
+        }
+    }
+}
+
+
+// -----------------------------------------------------------
+// Destructor - Destroys all elements and frees every chunk.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+chunkedForwardList<T, N, Allocator>::~chunkedForwardList() {
+    clear();
+}
+
+
+// -----------------------------------------------------------
+// chunkedForwardList Constructor (Copy) - Copies the elements of
+// the other list. The copy is packed into full chunks, however
+// sparse the source chunks were.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+chunkedForwardList<T, N, Allocator>::chunkedForwardList(const chunkedForwardList& other)
+    : m_head(nullptr), m_alloc(node_traits::select_on_container_copy_construction(other.m_alloc)) {
+    copy_chunks(other);
+}
+
+
+// -----------------------------------------------------------
+// chunkedForwardList Constructor (Move) - Takes over the chunks of
+// the other list, leaving it empty.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+chunkedForwardList<T, N, Allocator>::chunkedForwardList(chunkedForwardList&& other) noexcept
+    : m_head(nullptr), m_alloc(std::move(other.m_alloc)) {
+    steal(other);
+}
+
+
+// -----------------------------------------------------------
+// Assignment Operator - Performs a deep copy of the other list.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+chunkedForwardList<T, N, Allocator>& chunkedForwardList<T, N, Allocator>::operator=(const chunkedForwardList& other) {
+    if (this != &other) {
+        clear();
+        if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+            m_alloc = other.m_alloc;
+        }
+        copy_chunks(other);
+    }
+    return *this;
+}
+
+
+// -----------------------------------------------------------
+// Move Assignment Operator - Takes over the chunks of the other
+// list when the allocators allow it, and copies them otherwise.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+chunkedForwardList<T, N, Allocator>& chunkedForwardList<T, N, Allocator>::operator=(chunkedForwardList&& other) {
+    if (this == &other) {
+        return *this;
+    }
+    clear();
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+        m_alloc = std::move(other.m_alloc);
+        steal(other);
+    }
+    else {
+        if (node_traits::is_always_equal::value || m_alloc == other.m_alloc) {
+            steal(other);
+        }
+        else {
+            copy_chunks(other);
+            other.clear();
+        }
+    }
+    return *this;
+}
+
+
+// -----------------------------------------------------------
+// emplace_after - Constructs a new element right after pos (or at
+// the front if pos is the end iterator). A full chunk is split in
+// half first, so the insertion shifts at most N/2 elements. The
+// element is constructed in its final slot, unless the arguments
+// refer into the chunk whose elements are about to move, or moving
+// an element might throw; then it is built first and moved in.
+// Returns an iterator to the new element.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+template <typename... Args>
+typename chunkedForwardList<T, N, Allocator>::iterator chunkedForwardList<T, N, Allocator>::emplace_after(const_iterator pos, Args&&... args) {
+    if constexpr (s_nothrowRelocate) {
+        if (!points_into(pos.data ? pos.data : m_head, args...)) {
+            iterator place = make_room(pos);
+            try {
+                insert_at(place.data, place.index, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                drop_if_empty(pos, place.data);
+                throw;
+            }
+            ++m_size;
+            return place;
+        }
+    }
+
+    T value(std::forward<Args>(args)...);
+    iterator place = make_room(pos);
+    try {
+        insert_at(place.data, place.index, relocate(value));
+    }
+    catch (...) {
+        drop_if_empty(pos, place.data);
+        throw;
+    }
+    ++m_size;
+    return place;
+}
+
+
+// -----------------------------------------------------------
+// insert_after - Inserts a copy (or moves) the given value right
+// after pos. Returns an iterator to the new element.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+typename chunkedForwardList<T, N, Allocator>::iterator chunkedForwardList<T, N, Allocator>::insert_after(const_iterator pos, const T& value) {
+    return emplace_after(pos, value);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename chunkedForwardList<T, N, Allocator>::iterator chunkedForwardList<T, N, Allocator>::insert_after(const_iterator pos, T&& value) {
+    return emplace_after(pos, std::move(value));
+}
+
+
+// -----------------------------------------------------------
+// insert_range_after - Inserts a range of elements after pos. The
+// chunk holding pos is split once behind pos, the range is written
+// into the free slots and into new, full chunks, and the split-off
+// tail is linked back behind them. Returns an iterator to the last
+// inserted element, or pos if the range is empty.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+template <typename InputIt>
+typename chunkedForwardList<T, N, Allocator>::iterator chunkedForwardList<T, N, Allocator>::insert_range_after(const_iterator pos, InputIt first, InputIt last) {
+    if (first == last) {
+        return iterator(pos.data, pos.index);
+    }
+    if (!pos.data) {
+        emplace_front(*first);
+        pos = cbegin();
+        ++first;
+    }
+
+    chunk_type* current = pos.data;
+    if (pos.index + 1 < current->m_count) {
+        split(current, pos.index + 1);
+    }
+
+    while (first != last) {
+        if (current->m_count == N) {
+            chunk_type* fresh = create_chunk();
+            fresh->m_next = current->m_next;
+            current->m_next = fresh;
+            current = fresh;
+        }
+        ::new (static_cast<void*>(current->slot(current->m_count))) T(*first);
+        ++current->m_count;
+        ++m_size;
+        ++first;
+    }
+
+    iterator result(current, current->m_count - 1);
+    merge_with_next(current);
+    return result;
+}
+
+
+// -----------------------------------------------------------
+// erase_after - Removes the element following pos. If its chunk
+// becomes empty the chunk is unlinked; if it becomes sparse it is
+// merged with a neighbour.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+void chunkedForwardList<T, N, Allocator>::erase_after(const_iterator pos) {
+    if (!pos.data) {
+        throw std::invalid_argument("Cannot erase after the end iterator");
+    }
+    chunk_type* prev = nullptr;
+    chunk_type* node = pos.data;
+    size_type index = pos.index + 1;
+    if (index == node->m_count) {
+        prev = node;
+        node = node->m_next;
+        index = 0;
+        if (!node) {
+            return;
+        }
+    }
+    erase_at(prev, node, index);
+}
+
+
+// -----------------------------------------------------------
+// push_front - Adds an element at the front of the list.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+void chunkedForwardList<T, N, Allocator>::push_front(const T& value) {
+    emplace_after(cend(), value);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void chunkedForwardList<T, N, Allocator>::push_front(T&& value) {
+    emplace_after(cend(), std::move(value));
+}
+
+
+// -----------------------------------------------------------
+// emplace_front - Constructs an element at the front of the list.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+template <typename... Args>
+void chunkedForwardList<T, N, Allocator>::emplace_front(Args&&... args) {
+    emplace_after(cend(), std::forward<Args>(args)...);
+}
+
+
+// -----------------------------------------------------------
+// swap - Swaps the contents of this list with another list.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+void chunkedForwardList<T, N, Allocator>::swap(chunkedForwardList& other) {
+    std::swap(m_head, other.m_head);
+    std::swap(m_size, other.m_size);
+    std::swap(m_chunks, other.m_chunks);
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+        std::swap(m_alloc, other.m_alloc);
+    }
+}
+
+
+// -----------------------------------------------------------
+// begin / end - Iterators to the first element and past the last
+// element of the list.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+typename chunkedForwardList<T, N, Allocator>::iterator chunkedForwardList<T, N, Allocator>::begin() {
+    return iterator(m_head, 0);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename chunkedForwardList<T, N, Allocator>::iterator chunkedForwardList<T, N, Allocator>::end() {
+    return iterator(nullptr, 0);
+}
+
+
+// -----------------------------------------------------------
+// cbegin / cend - Constant iterators to the first element and past
+// the last element of the list.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+typename chunkedForwardList<T, N, Allocator>::const_iterator chunkedForwardList<T, N, Allocator>::cbegin() const {
+    return const_iterator(m_head, 0);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename chunkedForwardList<T, N, Allocator>::const_iterator chunkedForwardList<T, N, Allocator>::cend() const {
+    return const_iterator(nullptr, 0);
+}
+
+
+// -----------------------------------------------------------
+// empty - Checks if the list holds no elements.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+bool chunkedForwardList<T, N, Allocator>::empty() const {
+    return m_head == nullptr;
+}
+
+
+// -----------------------------------------------------------
+// size - Returns the number of elements, in constant time.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+typename chunkedForwardList<T, N, Allocator>::size_type chunkedForwardList<T, N, Allocator>::size() const noexcept {
+    return m_size;
+}
+
+
+// -----------------------------------------------------------
+// chunk_count - Returns the number of chunks currently linked,
+// which together with size() tells how densely they are filled.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+typename chunkedForwardList<T, N, Allocator>::size_type chunkedForwardList<T, N, Allocator>::chunk_count() const noexcept {
+    return m_chunks;
+}
+
+
+// -----------------------------------------------------------
+// clear - Destroys all elements and frees every chunk.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+void chunkedForwardList<T, N, Allocator>::clear() {
+    while (m_head) {
+        chunk_type* next = m_head->m_next;
+        destroy_chunk(m_head);
+        m_head = next;
+    }
+    m_size = 0;
+}
+
+
+// -----------------------------------------------------------
+// get_allocator - Returns a copy of the allocator associated
+// with the list, rebound back to the element type.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+typename chunkedForwardList<T, N, Allocator>::allocator_type chunkedForwardList<T, N, Allocator>::get_allocator() const {
+    return allocator_type(m_alloc);
+}
+
+
+// -----------------------------------------------------------
+// create_chunk - Allocates an empty, unlinked chunk.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+typename chunkedForwardList<T, N, Allocator>::chunk_type* chunkedForwardList<T, N, Allocator>::create_chunk() {
+    chunk_type* node = node_traits::allocate(m_alloc, 1);
+    node_traits::construct(m_alloc, node);
+    ++m_chunks;
+    return node;
+}
+
+
+// -----------------------------------------------------------
+// destroy_chunk - Destroys the live elements of a chunk and frees
+// it. The chunk must already be unlinked (or about to be).
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+void chunkedForwardList<T, N, Allocator>::destroy_chunk(chunk_type* node) {
+    for (size_type i = 0; i < node->m_count; ++i) {
+        node->slot(i)->~T();
+    }
+    node_traits::destroy(m_alloc, node);
+    node_traits::deallocate(m_alloc, node, 1);
+    --m_chunks;
+}
+
+
+// -----------------------------------------------------------
+// split - Moves the elements [at, count) of a chunk into a new
+// chunk linked right after it, and returns the new chunk.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+typename chunkedForwardList<T, N, Allocator>::chunk_type* chunkedForwardList<T, N, Allocator>::split(chunk_type* node, size_type at) {
+    chunk_type* right = create_chunk();
+    try {
+        for (size_type i = at; i < node->m_count; ++i) {
+            ::new (static_cast<void*>(right->slot(right->m_count))) T(relocate(*node->slot(i)));
+            ++right->m_count;
+        }
+    }
+    catch (...) {
+        destroy_chunk(right);
+        throw;
+    }
+    for (size_type i = at; i < node->m_count; ++i) {
+        node->slot(i)->~T();
+    }
+    node->m_count = at;
+    right->m_next = node->m_next;
+    node->m_next = right;
+    return right;
+}
+
+
+// -----------------------------------------------------------
+// make_room - Returns the chunk and slot that a new element after
+// pos goes into: a new chunk at the front if the first one is full,
+// or one half of pos's chunk after splitting it if that is full.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+typename chunkedForwardList<T, N, Allocator>::iterator chunkedForwardList<T, N, Allocator>::make_room(const_iterator pos) {
+    chunk_type* node = pos.data;
+    size_type index = pos.index + 1;
+    if (!node) {
+        if (!m_head || m_head->m_count == N) {
+            chunk_type* front = create_chunk();
+            front->m_next = m_head;
+            m_head = front;
+        }
+        node = m_head;
+        index = 0;
+    }
+    else if (node->m_count == N) {
+        const size_type mid = (N + 1) / 2;
+        chunk_type* right = split(node, mid);
+        if (index > mid || (index == mid && mid == N)) {
+            node = right;
+            index -= mid;
+        }
+    }
+    return iterator(node, index);
+}
+
+
+// -----------------------------------------------------------
+// drop_if_empty - Unlinks and frees a chunk that make_room added for
+// an element whose construction then failed. The chunk is either
+// the first one or the one right after pos.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+void chunkedForwardList<T, N, Allocator>::drop_if_empty(const_iterator pos, chunk_type* node) noexcept {
+    if (node->m_count != 0) {
+        return;
+    }
+    if (m_head == node) {
+        m_head = node->m_next;
+    }
+    else {
+        pos.data->m_next = node->m_next;
+    }
+    destroy_chunk(node);
+}
+
+
+// -----------------------------------------------------------
+// insert_at - Constructs an element from args in slot index of a
+// chunk that has room, shifting the elements behind it one slot to
+// the right. When elements move without throwing, the shift leaves
+// the slot empty and the element is constructed straight into it;
+// if that throws, the elements are shifted back. Otherwise args is
+// a single element to move in, as the shift may leave the chunk
+// with moved-from elements but never with an empty slot.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+template <typename... Args>
+void chunkedForwardList<T, N, Allocator>::insert_at(chunk_type* node, size_type index, Args&&... args) {
+    size_type count = node->m_count;
+    if constexpr (s_nothrowRelocate) {
+        for (size_type i = count; i > index; --i) {
+            ::new (static_cast<void*>(node->slot(i))) T(relocate(*node->slot(i - 1)));
+            node->slot(i - 1)->~T();
+        }
+        try {
+            ::new (static_cast<void*>(node->slot(index))) T(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            for (size_type i = index; i < count; ++i) {
+                ::new (static_cast<void*>(node->slot(i))) T(relocate(*node->slot(i + 1)));
+                node->slot(i + 1)->~T();
+            }
+            throw;
+        }
+    }
+    else if (index == count) {
+        ::new (static_cast<void*>(node->slot(count))) T(std::forward<Args>(args)...);
+    }
+    else {
+        ::new (static_cast<void*>(node->slot(count))) T(relocate(*node->slot(count - 1)));
+        for (size_type i = count - 1; i > index; --i) {
+            *node->slot(i) = relocate(*node->slot(i - 1));
+        }
+        ((*node->slot(index) = std::forward<Args>(args)), ...);
+    }
+    ++node->m_count;
+}
+
+
+// -----------------------------------------------------------
+// relocate - Casts an element to the reference it is moved (or,
+// if T cannot be moved, copied) from when it changes slots.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+typename chunkedForwardList<T, N, Allocator>::relocated_type chunkedForwardList<T, N, Allocator>::relocate(T& value) noexcept {
+    return static_cast<relocated_type>(value);
+}
+
+
+// -----------------------------------------------------------
+// points_into - Checks whether any of the arguments lies inside the
+// element storage of the given chunk, e.g. a reference to one of its
+// elements or to a member of one.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+template <typename... Args>
+bool chunkedForwardList<T, N, Allocator>::points_into(const chunk_type* node, const Args&... args) noexcept {
+    if (!node) {
+        return false;
+    }
+    std::less<const void*> before;
+    const unsigned char* first = node->m_storage;
+    const unsigned char* last = first + sizeof(node->m_storage);
+    return ((!before(static_cast<const void*>(std::addressof(args)), first) && before(static_cast<const void*>(std::addressof(args)), last)) || ...);
+}
+
+
+// -----------------------------------------------------------
+// erase_at - Removes the element at index of a chunk, shifting the
+// elements behind it one slot to the left. prev is the chunk before
+// node, or nullptr if node is the head or prev is not known because
+// node is guaranteed to stay non-empty.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+void chunkedForwardList<T, N, Allocator>::erase_at(chunk_type* prev, chunk_type* node, size_type index) {
+    for (size_type i = index + 1; i < node->m_count; ++i) {
+        *node->slot(i - 1) = relocate(*node->slot(i));
+    }
+    node->slot(node->m_count - 1)->~T();
+    --node->m_count;
+    --m_size;
+
+    if (node->m_count == 0) {
+        if (prev) {
+            prev->m_next = node->m_next;
+        }
+        else {
+            m_head = node->m_next;
+        }
+        destroy_chunk(node);
+        return;
+    }
+    if (prev && prev->m_count + node->m_count <= N - N / 4) {
+        merge_with_next(prev);
+    }
+    else {
+        merge_with_next(node);
+    }
+}
+
+
+// -----------------------------------------------------------
+// merge_with_next - Moves all elements of the next chunk into this
+// chunk and frees the next chunk, provided that together they fill
+// at most three quarters of a chunk. Keeping a quarter free avoids
+// splitting the merged chunk again on the very next insertion.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+void chunkedForwardList<T, N, Allocator>::merge_with_next(chunk_type* node) {
+    chunk_type* next = node->m_next;
+    if (!next || node->m_count + next->m_count > N - N / 4) {
+        return;
+    }
+    size_type moved = 0;
+    try {
+        for (; moved < next->m_count; ++moved) {
+            ::new (static_cast<void*>(node->slot(node->m_count + moved))) T(relocate(*next->slot(moved)));
+        }
+    }
+    catch (...) {
+        for (size_type i = 0; i < moved; ++i) {
+            node->slot(node->m_count + i)->~T();
+        }
+        throw;
+    }
+    node->m_count += moved;
+    node->m_next = next->m_next;
+    destroy_chunk(next);
+}
+
+
+// -----------------------------------------------------------
+// copy_chunks - Appends copies of all elements of the other list
+// to this (empty) list, packing them into full chunks.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+void chunkedForwardList<T, N, Allocator>::copy_chunks(const chunkedForwardList& other) {
+    chunk_type** link = &m_head;
+    chunk_type* tail = nullptr;
+    try {
+        for (const chunk_type* source = other.m_head; source; source = source->m_next) {
+            for (size_type i = 0; i < source->m_count; ++i) {
+                if (!tail || tail->m_count == N) {
+                    tail = create_chunk();
+                    *link = tail;
+                    link = &tail->m_next;
+                }
+                ::new (static_cast<void*>(tail->slot(tail->m_count))) T(*source->slot(i));
+                ++tail->m_count;
+                ++m_size;
+            }
+        }
+    }
+    catch (...) {
+        clear();
+        throw;
+    }
+}
+
+
+// -----------------------------------------------------------
+// steal - Takes over the chunks of the other list and leaves it
+// empty. This list must be empty.
+// -----------------------------------------------------------
+template <typename T, std::size_t N, typename Allocator>
+void chunkedForwardList<T, N, Allocator>::steal(chunkedForwardList& other) noexcept {
+    m_head = other.m_head;
+    m_size = other.m_size;
+    m_chunks = other.m_chunks;
+    other.m_head = nullptr;
+    other.m_size = 0;
+    other.m_chunks = 0;
+}
\ No newline at end of file
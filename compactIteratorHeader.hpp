@@ -0,0 +1,50 @@
+#ifndef COMPACT_ITERATOR_H
+#define COMPACT_ITERATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+template <typename T, typename Storage>
+class CompactIterator;
+
+// Forward iterator over a compactForwardList. It addresses an element by
+// its 32-bit slot index in the list's backing storage rather than by
+// address, so it stays valid when the backing arrays are reallocated. It
+// is invalidated when the element is erased, by compact() and by moving
+// or swapping the list.
+template <typename T, typename Storage>
+class CompactIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_const<T>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+    using index_type = std::uint32_t;
+    using storage_type = typename std::conditional<std::is_const<T>::value, const Storage, Storage>::type;
+
+    static constexpr index_type npos = static_cast<index_type>(-1);
+
+    CompactIterator();
+    CompactIterator(storage_type*, index_type);
+
+    template <typename U, typename = typename std::enable_if<std::is_same<const U, T>::value && !std::is_same<U, T>::value>::type>
+    CompactIterator(const CompactIterator<U, Storage>&);
+
+    reference operator*() const;
+    pointer operator->() const;
+    CompactIterator& operator++();
+    CompactIterator operator++(int);
+    bool operator==(const CompactIterator&) const;
+    bool operator!=(const CompactIterator&) const;
+
+public:
+    storage_type* storage;
+    index_type index;
+};
+
+#include "compactIteratorImplementation.tpp"
+
+#endif
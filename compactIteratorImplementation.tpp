@@ -0,0 +1,100 @@
+#include "compactIteratorHeader.hpp"
+
+/**
+ * @brief Default constructor for CompactIterator class.
+ *
+ * Initializes the iterator to the end position, which has no storage.
+ */
+template <typename T, typename Storage>
+CompactIterator<T, Storage>::CompactIterator() : storage(nullptr), index(npos) { }
+
+/**
+ * @brief Constructor for CompactIterator class that points at one slot.
+ *
+ * @param s The backing storage of the list.
+ * @param i The index of the element's slot, or npos for the end position.
+ */
+template <typename T, typename Storage>
+CompactIterator<T, Storage>::CompactIterator(storage_type* s, index_type i) : storage(s), index(i) { }
+
+/**
+ * @brief Converting constructor from a mutable iterator to a constant one.
+ *
+ * @param other The mutable iterator pointing to the same element.
+ */
+template <typename T, typename Storage>
+template <typename U, typename>
+CompactIterator<T, Storage>::CompactIterator(const CompactIterator<U, Storage>& other) : storage(other.storage), index(other.index) { }
+
+/**
+ * @brief Dereference operator to access the element the iterator is pointing to.
+ *
+ * @return reference A reference to the element.
+ */
+template <typename T, typename Storage>
+typename CompactIterator<T, Storage>::reference CompactIterator<T, Storage>::operator*() const {
+    return *storage->value(index);
+}
+
+/**
+ * @brief Arrow operator to access the element the iterator is pointing to.
+ *
+ * @return pointer A pointer to the element.
+ */
+template <typename T, typename Storage>
+typename CompactIterator<T, Storage>::pointer CompactIterator<T, Storage>::operator->() const {
+    return storage->value(index);
+}
+
+/**
+ * @brief Pre-increment operator to move the iterator forward.
+ *
+ * Follows the 32-bit link stored for the current slot.
+ *
+ * @return CompactIterator& A reference to the current iterator, after advancing.
+ */
+template <typename T, typename Storage>
+CompactIterator<T, Storage>& CompactIterator<T, Storage>::operator++() {
+    if (index != npos) {
+        index = storage->next(index);
+    }
+    return *this;
+}
+
+/**
+ * @brief Post-increment operator to move the iterator forward.
+ *
+ * @param int Placeholder for the post-increment syntax.
+ * @return CompactIterator A copy of the iterator before it was incremented.
+ */
+template <typename T, typename Storage>
+CompactIterator<T, Storage> CompactIterator<T, Storage>::operator++(int) {
+    CompactIterator tmp = *this;
+    ++(*this);
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for iterators.
+ *
+ * Two iterators are equal when they address the same slot. All end
+ * iterators compare equal, whatever storage they came from.
+ *
+ * @param other The iterator to compare with.
+ * @return bool True if both iterators point to the same position.
+ */
+template <typename T, typename Storage>
+bool CompactIterator<T, Storage>::operator==(const CompactIterator& other) const {
+    return index == other.index && (index == npos || storage == other.storage);
+}
+
+/**
+ * @brief Inequality comparison operator for iterators.
+ *
+ * @param other The iterator to compare with.
+ * @return bool True if the iterators point to different positions.
+ */
+template <typename T, typename Storage>
+bool CompactIterator<T, Storage>::operator!=(const CompactIterator& other) const {
+    return !(*this == other);
+}
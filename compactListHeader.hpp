@@ -0,0 +1,197 @@
+#ifndef COMPACT_LIST_H
+#define COMPACT_LIST_H
+
+#include "compactIteratorHeader.hpp"
+#include "listHeader.hpp"
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+// How compactForwardList lays out its slots: every value next to its link
+// in one array (arrayOfStructs), or all values in one array and all links
+// in another (structOfArrays). The latter wastes no padding between a
+// value and its 32-bit link, e.g. 12 instead of 16 bytes per 8-byte value.
+enum class nodeLayout { arrayOfStructs, structOfArrays };
+
+template <typename T, nodeLayout Layout = nodeLayout::structOfArrays, typename Allocator = std::allocator<T>>
+class compactForwardList;
+
+// Backing arrays of a compactForwardList: capacity() slots, each holding
+// raw storage for one value and a 32-bit link. The storage neither knows
+// nor tracks which slots hold live values; the list does.
+template <typename T, nodeLayout Layout, typename Allocator>
+class CompactStorage;
+
+template <typename T, typename Allocator>
+class CompactStorage<T, nodeLayout::arrayOfStructs, Allocator> {
+public:
+    using index_type = std::uint32_t;
+
+    explicit CompactStorage(const Allocator&);
+    CompactStorage(CompactStorage&&) noexcept;
+    ~CompactStorage();
+    CompactStorage(const CompactStorage&) = delete;
+    CompactStorage& operator=(const CompactStorage&) = delete;
+
+    T* value(index_type) noexcept;
+    const T* value(index_type) const noexcept;
+    index_type& next(index_type) noexcept;
+    index_type next(index_type) const noexcept;
+    index_type capacity() const noexcept;
+    void allocate(index_type);
+    void deallocate() noexcept;
+    void copy_raw(const CompactStorage&, index_type) noexcept;
+    void swap(CompactStorage&) noexcept;
+    Allocator get_allocator() const;
+
+private:
+    struct Slot {
+        alignas(T) unsigned char m_value[sizeof(T)];
+        index_type m_next;
+    };
+
+    using slot_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+    using slot_traits = std::allocator_traits<slot_allocator>;
+
+    slot_allocator m_alloc;
+    Slot* m_slots;
+    index_type m_capacity;
+};
+
+template <typename T, typename Allocator>
+class CompactStorage<T, nodeLayout::structOfArrays, Allocator> {
+public:
+    using index_type = std::uint32_t;
+
+    explicit CompactStorage(const Allocator&);
+    CompactStorage(CompactStorage&&) noexcept;
+    ~CompactStorage();
+    CompactStorage(const CompactStorage&) = delete;
+    CompactStorage& operator=(const CompactStorage&) = delete;
+
+    T* value(index_type) noexcept;
+    const T* value(index_type) const noexcept;
+    index_type& next(index_type) noexcept;
+    index_type next(index_type) const noexcept;
+    index_type capacity() const noexcept;
+    void allocate(index_type);
+    void deallocate() noexcept;
+    void copy_raw(const CompactStorage&, index_type) noexcept;
+    void swap(CompactStorage&) noexcept;
+    Allocator get_allocator() const;
+
+private:
+    struct Value {
+        alignas(T) unsigned char m_value[sizeof(T)];
+    };
+
+    using value_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Value>;
+    using value_traits = std::allocator_traits<value_allocator>;
+    using link_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<index_type>;
+    using link_traits = std::allocator_traits<link_allocator>;
+
+    value_allocator m_valueAlloc;
+    link_allocator m_linkAlloc;
+    Value* m_values;
+    index_type* m_links;
+    index_type m_capacity;
+};
+
+// Singly linked list whose nodes live in contiguous backing arrays and
+// link to each other through 32-bit slot indices instead of pointers.
+// For small elements this halves the memory per node compared with
+// forwardList (no 64-bit pointer, no per-node allocation header), and
+// compact() renumbers the nodes into traversal order so that a scan
+// becomes a sequential sweep of memory. Erased slots are recycled
+// through a free list threaded through the links.
+//
+// The interface mirrors chunkedForwardList. The backing arrays grow by
+// doubling, which moves the elements: iterators (which hold indices)
+// stay valid, but pointers and references to elements do not. A list
+// holds at most 2^32 - 1 elements.
+template <typename T, nodeLayout Layout, typename Allocator>
+class compactForwardList {
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using index_type = std::uint32_t;
+    using storage_type = CompactStorage<T, Layout, Allocator>;
+    using iterator = CompactIterator<T, storage_type>;
+    using const_iterator = CompactIterator<const T, storage_type>;
+
+    static constexpr index_type npos = iterator::npos;
+
+public:
+    compactForwardList();
+    explicit compactForwardList(const Allocator&);
+    compactForwardList(size_type, const T&, const Allocator& = Allocator());
+
+    template <typename InputIt, typename = typename std::enable_if<isInputIterator<InputIt>::value>::type>
+    compactForwardList(InputIt, InputIt, const Allocator& = Allocator());
+
+    compactForwardList(std::initializer_list<T>, const Allocator& = Allocator());
+    ~compactForwardList();
+    compactForwardList(const compactForwardList&);
+    compactForwardList(compactForwardList&&) noexcept;
+    compactForwardList& operator=(const compactForwardList&);
+    compactForwardList& operator=(compactForwardList&&);
+
+    template <typename... Args>
+    iterator emplace_after(const_iterator, Args&&...);
+    iterator insert_after(const_iterator, const T&);
+    iterator insert_after(const_iterator, T&&);
+    void erase_after(const_iterator);
+    void push_front(const T&);
+    void push_front(T&&);
+    void push_back(const T&);
+    void push_back(T&&);
+
+    template <typename... Args>
+    void emplace_front(Args&&...);
+
+    template <typename... Args>
+    void emplace_back(Args&&...);
+
+    void reserve(size_type);
+    void compact();
+    void shrink_to_fit();
+    void swap(compactForwardList&) noexcept;
+    iterator begin();
+    iterator end();
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    bool empty() const;
+    size_type size() const noexcept;
+    size_type capacity() const noexcept;
+    size_type max_size() const noexcept;
+    void clear();
+    allocator_type get_allocator() const;
+
+private:
+    template <typename... Args>
+    index_type create_slot(Args&&...);
+    void release_slot(index_type) noexcept;
+    void link_after(index_type, index_type) noexcept;
+    void grow();
+    void relocate(index_type, bool);
+    void destroy_values() noexcept;
+    void steal(compactForwardList&) noexcept;
+
+    storage_type m_storage;
+    index_type m_head = npos;
+    index_type m_tail = npos;
+    index_type m_free = npos;
+    index_type m_used = 0;
+    index_type m_size = 0;
+};
+
+#include "compactListImplementation.tpp"
+
+#endif
@@ -0,0 +1,768 @@
+#include "compactListHeader.hpp"
+
+// -----------------------------------------------------------
+// CompactStorage (Array of Structs) - One array of slots, each
+// holding a value followed by its link.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::CompactStorage(const Allocator& alloc)
+    : m_alloc(alloc), m_slots(nullptr), m_capacity(0) { }
+
+// Takes over the slots of other, leaving it empty. The allocator is
+// copied rather than moved, so other can still allocate.
+template <typename T, typename Allocator>
+CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::CompactStorage(CompactStorage&& other) noexcept
+    : m_alloc(other.m_alloc), m_slots(other.m_slots), m_capacity(other.m_capacity) {
+    other.m_slots = nullptr;
+    other.m_capacity = 0;
+}
+
+template <typename T, typename Allocator>
+CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::~CompactStorage() {
+    deallocate();
+}
+
+template <typename T, typename Allocator>
+T* CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::value(index_type i) noexcept {
+    return std::launder(reinterpret_cast<T*>(m_slots[i].m_value));
+}
+
+template <typename T, typename Allocator>
+const T* CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::value(index_type i) const noexcept {
+    return std::launder(reinterpret_cast<const T*>(m_slots[i].m_value));
+}
+
+template <typename T, typename Allocator>
+typename CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::index_type&
+CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::next(index_type i) noexcept {
+    return m_slots[i].m_next;
+}
+
+template <typename T, typename Allocator>
+typename CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::index_type
+CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::next(index_type i) const noexcept {
+    return m_slots[i].m_next;
+}
+
+template <typename T, typename Allocator>
+typename CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::index_type
+CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::capacity() const noexcept {
+    return m_capacity;
+}
+
+// Allocates capacity slots. The storage must not hold any yet.
+template <typename T, typename Allocator>
+void CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::allocate(index_type capacity) {
+    m_slots = slot_traits::allocate(m_alloc, capacity);
+    m_capacity = capacity;
+}
+
+template <typename T, typename Allocator>
+void CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::deallocate() noexcept {
+    if (m_slots) {
+        slot_traits::deallocate(m_alloc, m_slots, m_capacity);
+        m_slots = nullptr;
+        m_capacity = 0;
+    }
+}
+
+// Copies the bytes of the first count slots of other, values and
+// links alike. Only meaningful for trivially copyable values.
+template <typename T, typename Allocator>
+void CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::copy_raw(const CompactStorage& other, index_type count) noexcept {
+    if (count) {
+        std::memcpy(static_cast<void*>(m_slots), other.m_slots, count * sizeof(Slot));
+    }
+}
+
+template <typename T, typename Allocator>
+void CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::swap(CompactStorage& other) noexcept {
+    std::swap(m_alloc, other.m_alloc);
+    std::swap(m_slots, other.m_slots);
+    std::swap(m_capacity, other.m_capacity);
+}
+
+template <typename T, typename Allocator>
+Allocator CompactStorage<T, nodeLayout::arrayOfStructs, Allocator>::get_allocator() const {
+    return Allocator(m_alloc);
+}
+
+
+// -----------------------------------------------------------
+// CompactStorage (Struct of Arrays) - One array of values and a
+// parallel array of links, both allocated at the same capacity.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+CompactStorage<T, nodeLayout::structOfArrays, Allocator>::CompactStorage(const Allocator& alloc)
+    : m_valueAlloc(alloc), m_linkAlloc(alloc), m_values(nullptr), m_links(nullptr), m_capacity(0) { }
+
+template <typename T, typename Allocator>
+CompactStorage<T, nodeLayout::structOfArrays, Allocator>::CompactStorage(CompactStorage&& other) noexcept
+    : m_valueAlloc(other.m_valueAlloc), m_linkAlloc(other.m_linkAlloc),
+      m_values(other.m_values), m_links(other.m_links), m_capacity(other.m_capacity) {
+    other.m_values = nullptr;
+    other.m_links = nullptr;
+    other.m_capacity = 0;
+}
+
+template <typename T, typename Allocator>
+CompactStorage<T, nodeLayout::structOfArrays, Allocator>::~CompactStorage() {
+    deallocate();
+}
+
+template <typename T, typename Allocator>
+T* CompactStorage<T, nodeLayout::structOfArrays, Allocator>::value(index_type i) noexcept {
+    return std::launder(reinterpret_cast<T*>(m_values[i].m_value));
+}
+
+template <typename T, typename Allocator>
+const T* CompactStorage<T, nodeLayout::structOfArrays, Allocator>::value(index_type i) const noexcept {
+    return std::launder(reinterpret_cast<const T*>(m_values[i].m_value));
+}
+
+template <typename T, typename Allocator>
+typename CompactStorage<T, nodeLayout::structOfArrays, Allocator>::index_type&
+CompactStorage<T, nodeLayout::structOfArrays, Allocator>::next(index_type i) noexcept {
+    return m_links[i];
+}
+
+template <typename T, typename Allocator>
+typename CompactStorage<T, nodeLayout::structOfArrays, Allocator>::index_type
+CompactStorage<T, nodeLayout::structOfArrays, Allocator>::next(index_type i) const noexcept {
+    return m_links[i];
+}
+
+template <typename T, typename Allocator>
+typename CompactStorage<T, nodeLayout::structOfArrays, Allocator>::index_type
+CompactStorage<T, nodeLayout::structOfArrays, Allocator>::capacity() const noexcept {
+    return m_capacity;
+}
+
+// Allocates both arrays. The storage must not hold any yet.
+template <typename T, typename Allocator>
+void CompactStorage<T, nodeLayout::structOfArrays, Allocator>::allocate(index_type capacity) {
+    m_values = value_traits::allocate(m_valueAlloc, capacity);
+    try {
+        m_links = link_traits::allocate(m_linkAlloc, capacity);
+    }
+    catch (...) {
+        value_traits::deallocate(m_valueAlloc, m_values, capacity);
+        m_values = nullptr;
+        throw;
+    }
+    m_capacity = capacity;
+}
+
+template <typename T, typename Allocator>
+void CompactStorage<T, nodeLayout::structOfArrays, Allocator>::deallocate() noexcept {
+    if (m_values) {
+        value_traits::deallocate(m_valueAlloc, m_values, m_capacity);
+        link_traits::deallocate(m_linkAlloc, m_links, m_capacity);
+        m_values = nullptr;
+        m_links = nullptr;
+        m_capacity = 0;
+    }
+}
+
+template <typename T, typename Allocator>
+void CompactStorage<T, nodeLayout::structOfArrays, Allocator>::copy_raw(const CompactStorage& other, index_type count) noexcept {
+    if (count) {
+        std::memcpy(static_cast<void*>(m_values), other.m_values, count * sizeof(Value));
+        std::memcpy(m_links, other.m_links, count * sizeof(index_type));
+    }
+}
+
+template <typename T, typename Allocator>
+void CompactStorage<T, nodeLayout::structOfArrays, Allocator>::swap(CompactStorage& other) noexcept {
+    std::swap(m_valueAlloc, other.m_valueAlloc);
+    std::swap(m_linkAlloc, other.m_linkAlloc);
+    std::swap(m_values, other.m_values);
+    std::swap(m_links, other.m_links);
+    std::swap(m_capacity, other.m_capacity);
+}
+
+template <typename T, typename Allocator>
+Allocator CompactStorage<T, nodeLayout::structOfArrays, Allocator>::get_allocator() const {
+    return Allocator(m_valueAlloc);
+}
+
+
+// -----------------------------------------------------------
+// compactForwardList Constructor (Default) - Initializes an empty
+// list with no backing storage.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+compactForwardList<T, Layout, Allocator>::compactForwardList() : m_storage(Allocator()) { }
+
+
+// -----------------------------------------------------------
+// compactForwardList Constructor (Allocator) - Initializes an empty
+// list whose backing arrays will be obtained from the given
+// allocator.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+compactForwardList<T, Layout, Allocator>::compactForwardList(const Allocator& alloc) : m_storage(alloc) { }
+
+
+// -----------------------------------------------------------
+// compactForwardList Constructor (Count and Value) - Creates a list
+// of count copies of value, in slots 0 to count - 1.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+compactForwardList<T, Layout, Allocator>::compactForwardList(size_type count, const T& value, const Allocator& alloc)
+    : m_storage(alloc) {
+    try {
+        reserve(count);
+        for (size_type i = 0; i < count; ++i) {
+            emplace_back(value);
+        }
+    }
+    catch (...) {
+        destroy_values();
+        throw;
+    }
+}
+
+
+// -----------------------------------------------------------
+// compactForwardList Constructor (Range) - Creates a list holding
+// copies of the elements of [first, last), in order. The storage is
+// sized once up front when the range can be measured.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+template <typename InputIt, typename>
+compactForwardList<T, Layout, Allocator>::compactForwardList(InputIt first, InputIt last, const Allocator& alloc)
+    : m_storage(alloc) {
+    try {
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+            reserve(static_cast<size_type>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+    catch (...) {
+        destroy_values();
+        throw;
+    }
+}
+
+
+// -----------------------------------------------------------
+// compactForwardList Constructor (Initializer List) - Creates a
+// list holding copies of the given values, in order.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+compactForwardList<T, Layout, Allocator>::compactForwardList(std::initializer_list<T> values, const Allocator& alloc)
+    : compactForwardList(values.begin(), values.end(), alloc) { }
+
+
+// -----------------------------------------------------------
+// Destructor - Destroys all elements; the storage frees the
+// backing arrays.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+compactForwardList<T, Layout, Allocator>::~compactForwardList() {
+    destroy_values();
+}
+
+
+// -----------------------------------------------------------
+// compactForwardList Constructor (Copy) - Copies the elements of
+// the other list in traversal order, so the copy comes out compact
+// however scattered the source slots were.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+compactForwardList<T, Layout, Allocator>::compactForwardList(const compactForwardList& other)
+    : m_storage(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator())) {
+    try {
+        reserve(other.m_size);
+        for (const_iterator it = other.cbegin(); it != other.cend(); ++it) {
+            emplace_back(*it);
+        }
+    }
+    catch (...) {
+        destroy_values();
+        throw;
+    }
+}
+
+
+// -----------------------------------------------------------
+// compactForwardList Constructor (Move) - Takes over the backing
+// storage of the other list, together with its (already rebound)
+// allocators, leaving it empty.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+compactForwardList<T, Layout, Allocator>::compactForwardList(compactForwardList&& other) noexcept
+    : m_storage(std::move(other.m_storage)) {
+    steal(other);
+}
+
+
+// -----------------------------------------------------------
+// Assignment Operator - Builds a compact copy of the other list
+// and swaps it in, so this list is unchanged if a copy throws.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+compactForwardList<T, Layout, Allocator>& compactForwardList<T, Layout, Allocator>::operator=(const compactForwardList& other) {
+    if (this != &other) {
+        Allocator alloc = get_allocator();
+        if constexpr (std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value) {
+            alloc = other.get_allocator();
+        }
+        compactForwardList copy(other.cbegin(), other.cend(), alloc);
+        swap(copy);
+    }
+    return *this;
+}
+
+
+// -----------------------------------------------------------
+// Move Assignment Operator - Takes over the backing storage of the
+// other list when the allocators allow it, and moves the elements
+// one by one otherwise.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+compactForwardList<T, Layout, Allocator>& compactForwardList<T, Layout, Allocator>::operator=(compactForwardList&& other) {
+    if (this == &other) {
+        return *this;
+    }
+    clear();
+    using alloc_traits = std::allocator_traits<Allocator>;
+    if (alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value ||
+        get_allocator() == other.get_allocator()) {
+        m_storage.swap(other.m_storage);
+        steal(other);
+    }
+    else {
+        reserve(other.m_size);
+        for (iterator it = other.begin(); it != other.end(); ++it) {
+            emplace_back(std::move(*it));
+        }
+        other.clear();
+    }
+    return *this;
+}
+
+
+// -----------------------------------------------------------
+// emplace_after - Constructs a new element in a free slot and links
+// it right after pos (or at the front if pos is the end iterator).
+// Returns an iterator to the new element.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+template <typename... Args>
+typename compactForwardList<T, Layout, Allocator>::iterator compactForwardList<T, Layout, Allocator>::emplace_after(const_iterator pos, Args&&... args) {
+    index_type slot = create_slot(std::forward<Args>(args)...);
+    link_after(pos.index, slot);
+    ++m_size;
+    return iterator(&m_storage, slot);
+}
+
+
+// -----------------------------------------------------------
+// insert_after - Inserts a copy (or moves) the given value right
+// after pos. Returns an iterator to the new element.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+typename compactForwardList<T, Layout, Allocator>::iterator compactForwardList<T, Layout, Allocator>::insert_after(const_iterator pos, const T& value) {
+    return emplace_after(pos, value);
+}
+
+template <typename T, nodeLayout Layout, typename Allocator>
+typename compactForwardList<T, Layout, Allocator>::iterator compactForwardList<T, Layout, Allocator>::insert_after(const_iterator pos, T&& value) {
+    return emplace_after(pos, std::move(value));
+}
+
+
+// -----------------------------------------------------------
+// erase_after - Removes the element following pos and puts its slot
+// on the free list. Does nothing if pos is the last element.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::erase_after(const_iterator pos) {
+    if (pos.index == npos) {
+        throw std::invalid_argument("Cannot erase after the end iterator");
+    }
+    index_type victim = m_storage.next(pos.index);
+    if (victim == npos) {
+        return;
+    }
+    m_storage.next(pos.index) = m_storage.next(victim);
+    if (m_tail == victim) {
+        m_tail = pos.index;
+    }
+    release_slot(victim);
+    --m_size;
+}
+
+
+// -----------------------------------------------------------
+// push_front - Adds an element at the front of the list.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::push_front(const T& value) {
+    emplace_after(cend(), value);
+}
+
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::push_front(T&& value) {
+    emplace_after(cend(), std::move(value));
+}
+
+
+// -----------------------------------------------------------
+// push_back - Adds an element at the end of the list, in constant
+// time.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::push_back(const T& value) {
+    emplace_back(value);
+}
+
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::push_back(T&& value) {
+    emplace_back(std::move(value));
+}
+
+
+// -----------------------------------------------------------
+// emplace_front - Constructs an element at the front of the list.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+template <typename... Args>
+void compactForwardList<T, Layout, Allocator>::emplace_front(Args&&... args) {
+    emplace_after(cend(), std::forward<Args>(args)...);
+}
+
+
+// -----------------------------------------------------------
+// emplace_back - Constructs an element at the end of the list.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+template <typename... Args>
+void compactForwardList<T, Layout, Allocator>::emplace_back(Args&&... args) {
+    emplace_after(const_iterator(&m_storage, m_tail), std::forward<Args>(args)...);
+}
+
+
+// -----------------------------------------------------------
+// reserve - Grows the backing arrays to hold at least count
+// elements, so that the next inserts do not move the elements.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::reserve(size_type count) {
+    if (count > max_size()) {
+        throw std::length_error("compactForwardList cannot hold more than 2^32 - 1 elements");
+    }
+    if (count > m_storage.capacity()) {
+        relocate(static_cast<index_type>(count), false);
+    }
+}
+
+
+// -----------------------------------------------------------
+// compact - Renumbers the elements into traversal order: the i-th
+// element moves to slot i and links to slot i + 1, and the free list
+// is dropped. A scan then sweeps the backing arrays sequentially
+// instead of jumping around them. Keeps the capacity; the elements
+// are moved through a second set of arrays of the same size.
+// Invalidates all iterators.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::compact() {
+    if (m_size == 0) {
+        m_free = npos;
+        m_used = 0;
+        return;
+    }
+    relocate(m_storage.capacity(), true);
+}
+
+
+// -----------------------------------------------------------
+// shrink_to_fit - Like compact(), but also shrinks the backing
+// arrays to exactly size() slots.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::shrink_to_fit() {
+    if (m_size == 0) {
+        clear();
+        return;
+    }
+    relocate(m_size, true);
+}
+
+
+// -----------------------------------------------------------
+// swap - Swaps the contents of this list with another list. The
+// allocators travel with the backing storage they allocated.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::swap(compactForwardList& other) noexcept {
+    m_storage.swap(other.m_storage);
+    std::swap(m_head, other.m_head);
+    std::swap(m_tail, other.m_tail);
+    std::swap(m_free, other.m_free);
+    std::swap(m_used, other.m_used);
+    std::swap(m_size, other.m_size);
+}
+
+
+// -----------------------------------------------------------
+// begin / end - Iterators to the first element and past the last
+// element of the list.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+typename compactForwardList<T, Layout, Allocator>::iterator compactForwardList<T, Layout, Allocator>::begin() {
+    return iterator(&m_storage, m_head);
+}
+
+template <typename T, nodeLayout Layout, typename Allocator>
+typename compactForwardList<T, Layout, Allocator>::iterator compactForwardList<T, Layout, Allocator>::end() {
+    return iterator(&m_storage, npos);
+}
+
+
+// -----------------------------------------------------------
+// cbegin / cend - Constant iterators to the first element and past
+// the last element of the list.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+typename compactForwardList<T, Layout, Allocator>::const_iterator compactForwardList<T, Layout, Allocator>::cbegin() const {
+    return const_iterator(&m_storage, m_head);
+}
+
+template <typename T, nodeLayout Layout, typename Allocator>
+typename compactForwardList<T, Layout, Allocator>::const_iterator compactForwardList<T, Layout, Allocator>::cend() const {
+    return const_iterator(&m_storage, npos);
+}
+
+
+// -----------------------------------------------------------
+// empty - Checks if the list holds no elements.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+bool compactForwardList<T, Layout, Allocator>::empty() const {
+    return m_size == 0;
+}
+
+
+// -----------------------------------------------------------
+// size - Returns the number of elements, in constant time.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+typename compactForwardList<T, Layout, Allocator>::size_type compactForwardList<T, Layout, Allocator>::size() const noexcept {
+    return m_size;
+}
+
+
+// -----------------------------------------------------------
+// capacity - Returns the number of slots in the backing arrays.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+typename compactForwardList<T, Layout, Allocator>::size_type compactForwardList<T, Layout, Allocator>::capacity() const noexcept {
+    return m_storage.capacity();
+}
+
+
+// -----------------------------------------------------------
+// max_size - Returns the largest number of elements a list can
+// hold: every 32-bit index except npos.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+typename compactForwardList<T, Layout, Allocator>::size_type compactForwardList<T, Layout, Allocator>::max_size() const noexcept {
+    return npos;
+}
+
+
+// -----------------------------------------------------------
+// clear - Destroys all elements and frees the backing arrays.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::clear() {
+    destroy_values();
+    m_storage.deallocate();
+    m_head = npos;
+    m_tail = npos;
+    m_free = npos;
+    m_used = 0;
+    m_size = 0;
+}
+
+
+// -----------------------------------------------------------
+// get_allocator - Returns a copy of the allocator associated
+// with the list, rebound back to the element type.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+typename compactForwardList<T, Layout, Allocator>::allocator_type compactForwardList<T, Layout, Allocator>::get_allocator() const {
+    return m_storage.get_allocator();
+}
+
+
+// -----------------------------------------------------------
+// create_slot - Constructs a value in a free slot, preferring
+// recycled slots over fresh ones, and returns the slot's index.
+// The slot is not linked yet. If the arrays must grow, the value is
+// built before they move, since args may refer to an element.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+template <typename... Args>
+typename compactForwardList<T, Layout, Allocator>::index_type compactForwardList<T, Layout, Allocator>::create_slot(Args&&... args) {
+    if (m_free == npos && m_used == m_storage.capacity()) {
+        T value(std::forward<Args>(args)...);
+        grow();
+        ::new (static_cast<void*>(m_storage.value(m_used))) T(std::move(value));
+        return m_used++;
+    }
+    index_type slot = m_free != npos ? m_free : m_used;
+    ::new (static_cast<void*>(m_storage.value(slot))) T(std::forward<Args>(args)...);
+    if (slot == m_free) {
+        m_free = m_storage.next(slot);
+    }
+    else {
+        ++m_used;
+    }
+    return slot;
+}
+
+
+// -----------------------------------------------------------
+// release_slot - Destroys the value of an unlinked slot and pushes
+// the slot onto the free list.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::release_slot(index_type slot) noexcept {
+    m_storage.value(slot)->~T();
+    m_storage.next(slot) = m_free;
+    m_free = slot;
+}
+
+
+// -----------------------------------------------------------
+// link_after - Links slot right after the slot pos, or at the front
+// if pos is npos, keeping the tail index up to date.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::link_after(index_type pos, index_type slot) noexcept {
+    if (pos == npos) {
+        m_storage.next(slot) = m_head;
+        m_head = slot;
+        if (m_tail == npos) {
+            m_tail = slot;
+        }
+    }
+    else {
+        m_storage.next(slot) = m_storage.next(pos);
+        m_storage.next(pos) = slot;
+        if (m_tail == pos) {
+            m_tail = slot;
+        }
+    }
+}
+
+
+// -----------------------------------------------------------
+// grow - Doubles the capacity of the backing arrays, starting at 16
+// slots and stopping at the 32-bit index limit.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::grow() {
+    const index_type capacity = m_storage.capacity();
+    if (capacity == npos) {
+        throw std::length_error("compactForwardList cannot hold more than 2^32 - 1 elements");
+    }
+    relocate(capacity < 16 ? 16 : (capacity > npos / 2 ? npos : capacity * 2), false);
+}
+
+
+// -----------------------------------------------------------
+// relocate - Moves the elements into new backing arrays of the given
+// capacity. Without renumbering every element keeps its slot index
+// (and trivially copyable elements are copied with one memcpy per
+// array); with renumbering the elements are laid out in traversal
+// order. The list is unchanged if moving an element throws.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::relocate(index_type capacity, bool renumber) {
+    storage_type fresh(m_storage.get_allocator());
+    fresh.allocate(capacity);
+
+    if (!renumber && std::is_trivially_copyable<T>::value) {
+        fresh.copy_raw(m_storage, m_used);
+        m_storage.swap(fresh);
+        return;
+    }
+
+    index_type count = 0;
+    try {
+        for (index_type i = m_head; i != npos; i = m_storage.next(i)) {
+            ::new (static_cast<void*>(fresh.value(renumber ? count : i))) T(std::move_if_noexcept(*m_storage.value(i)));
+            ++count;
+        }
+    }
+    catch (...) {
+        index_type i = m_head;
+        for (index_type k = 0; k < count; ++k, i = m_storage.next(i)) {
+            fresh.value(renumber ? k : i)->~T();
+        }
+        throw;
+    }
+
+    if (renumber) {
+        for (index_type k = 0; k < count; ++k) {
+            fresh.next(k) = k + 1 == count ? npos : k + 1;
+        }
+    }
+    else {
+        for (index_type k = 0; k < m_used; ++k) {
+            fresh.next(k) = m_storage.next(k);
+        }
+    }
+    destroy_values();
+    m_storage.swap(fresh);
+
+    if (renumber) {
+        m_head = count ? 0 : npos;
+        m_tail = count ? count - 1 : npos;
+        m_free = npos;
+        m_used = count;
+    }
+}
+
+
+// -----------------------------------------------------------
+// destroy_values - Destroys every linked element, leaving the
+// backing arrays and the indices alone.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::destroy_values() noexcept {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (index_type i = m_head; i != npos; i = m_storage.next(i)) {
+            m_storage.value(i)->~T();
+        }
+    }
+}
+
+
+// -----------------------------------------------------------
+// steal - Takes over the indices of the other list, whose backing
+// storage has already been moved into this one, and leaves it
+// empty.
+// -----------------------------------------------------------
+template <typename T, nodeLayout Layout, typename Allocator>
+void compactForwardList<T, Layout, Allocator>::steal(compactForwardList& other) noexcept {
+    m_head = other.m_head;
+    m_tail = other.m_tail;
+    m_free = other.m_free;
+    m_used = other.m_used;
+    m_size = other.m_size;
+    other.m_head = npos;
+    other.m_tail = npos;
+    other.m_free = npos;
+    other.m_used = 0;
+    other.m_size = 0;
+}
@@ -0,0 +1,77 @@
+#ifndef CONCURRENT_ITERATOR_H
+#define CONCURRENT_ITERATOR_H
+
+#include "epochReclamationHeader.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+template <typename T>
+class ConcurrentIterator;
+
+template <typename T>
+class concurrentForwardList;
+
+// The link part of a concurrent node. The lowest bit of m_next marks the
+// node owning the link as erased; a marked link is never changed again.
+class ConcurrentLink {
+private:
+    std::atomic<std::uintptr_t> m_next;
+public:
+    ConcurrentLink();
+
+    static bool marked(std::uintptr_t) noexcept;
+    static ConcurrentLink* pointer(std::uintptr_t) noexcept;
+
+    template <typename>
+    friend class concurrentForwardList;
+    template <typename>
+    friend class ConcurrentIterator;
+};
+
+template <typename T>
+class ConcurrentNode;
+
+// Forward iterator over a concurrentForwardList. It skips elements that
+// have been erased and holds an epochGuard, so the node it points to (and
+// every node reachable from it) stays allocated while the iterator lives,
+// even if other threads erase them. An iterator must not be handed to
+// another thread; once it reaches the end it drops its pin.
+template <typename T>
+class ConcurrentIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_const<T>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+    using node_type = ConcurrentNode<typename std::remove_const<T>::type>;
+
+    ConcurrentIterator();
+    ConcurrentIterator(ConcurrentLink*, epochGuard);
+
+    template <typename U, typename = typename std::enable_if<std::is_same<const U, T>::value && !std::is_same<U, T>::value>::type>
+    ConcurrentIterator(const ConcurrentIterator<U>&);
+
+    reference operator*() const;
+    pointer operator->() const;
+    ConcurrentIterator& operator++();
+    ConcurrentIterator operator++(int);
+    bool operator==(const ConcurrentIterator&) const;
+    bool operator!=(const ConcurrentIterator&) const;
+
+    template <typename>
+    friend class concurrentForwardList;
+    template <typename>
+    friend class ConcurrentIterator;
+public:
+    ConcurrentLink* data;
+private:
+    epochGuard m_guard;
+};
+
+#include "concurrentIteratorImplementation.tpp"
+
+#endif
\ No newline at end of file
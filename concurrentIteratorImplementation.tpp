@@ -0,0 +1,137 @@
+#include "concurrentIteratorHeader.hpp"
+
+/**
+ * @brief Constructor for ConcurrentLink class.
+ *
+ * Initializes an unmarked link to no node.
+ */
+inline ConcurrentLink::ConcurrentLink() : m_next(0) { }
+
+/**
+ * @brief Checks whether a link value carries the erased mark.
+ *
+ * @param link The raw value of a next link.
+ * @return bool True if the node owning the link has been erased.
+ */
+inline bool ConcurrentLink::marked(std::uintptr_t link) noexcept {
+    return (link & 1) != 0;
+}
+
+/**
+ * @brief Extracts the node address from a link value, dropping the mark.
+ *
+ * @param link The raw value of a next link.
+ * @return ConcurrentLink* The node the link points to, or nullptr.
+ */
+inline ConcurrentLink* ConcurrentLink::pointer(std::uintptr_t link) noexcept {
+    return reinterpret_cast<ConcurrentLink*>(link & ~std::uintptr_t(1));
+}
+
+/**
+ * @brief Default constructor for ConcurrentIterator class.
+ *
+ * Creates the end iterator. It points to no node and pins nothing.
+ */
+template <typename T>
+ConcurrentIterator<T>::ConcurrentIterator() : data(nullptr), m_guard(std::defer_lock) { }
+
+/**
+ * @brief Constructor for ConcurrentIterator class that points at a given link.
+ *
+ * The guard must have been taken before the link was read from the list.
+ *
+ * @param p A pointer to the link (a node, or the list's head sentinel).
+ * @param guard The epoch guard keeping the link alive.
+ */
+template <typename T>
+ConcurrentIterator<T>::ConcurrentIterator(ConcurrentLink* p, epochGuard guard) : data(p), m_guard(std::move(guard)) {
+    if (!data) {
+        m_guard.release();
+    }
+}
+
+/**
+ * @brief Converting constructor from a mutable iterator to a constant one.
+ *
+ * @param other The mutable iterator pointing to the same node.
+ */
+template <typename T>
+template <typename U, typename>
+ConcurrentIterator<T>::ConcurrentIterator(const ConcurrentIterator<U>& other) : data(other.data), m_guard(other.m_guard) { }
+
+/**
+ * @brief Dereference operator to access the value of the node the iterator is pointing to.
+ *
+ * @return reference A reference to the data stored in the node.
+ */
+template <typename T>
+typename ConcurrentIterator<T>::reference ConcurrentIterator<T>::operator*() const {
+    return static_cast<node_type*>(data)->m_data;
+}
+
+/**
+ * @brief Arrow operator to access the value of the node the iterator is pointing to.
+ *
+ * @return pointer A pointer to the data stored in the node.
+ */
+template <typename T>
+typename ConcurrentIterator<T>::pointer ConcurrentIterator<T>::operator->() const {
+    return &static_cast<node_type*>(data)->m_data;
+}
+
+/**
+ * @brief Pre-increment operator to move the iterator forward.
+ *
+ * Follows the next link and skips nodes that are marked as erased. The
+ * pin is dropped as soon as the end of the list is reached.
+ *
+ * @return ConcurrentIterator& A reference to the current iterator, after advancing.
+ */
+template <typename T>
+ConcurrentIterator<T>& ConcurrentIterator<T>::operator++() {
+    if (data) {
+        data = ConcurrentLink::pointer(data->m_next.load(std::memory_order_acquire));
+        while (data && ConcurrentLink::marked(data->m_next.load(std::memory_order_acquire))) {
+            data = ConcurrentLink::pointer(data->m_next.load(std::memory_order_acquire));  // Skip erased nodes.
+        }
+        if (!data) {
+            m_guard.release();
+        }
+    }
+    return *this;
+}
+
+/**
+ * @brief Post-increment operator to move the iterator forward.
+ *
+ * @param int Placeholder for the post-increment syntax.
+ * @return ConcurrentIterator A copy of the iterator before it was incremented.
+ */
+template <typename T>
+ConcurrentIterator<T> ConcurrentIterator<T>::operator++(int) {
+    ConcurrentIterator tmp = *this;
+    ++(*this);
+    return tmp;
+}
+
+/**
+ * @brief Equality comparison operator for iterators.
+ *
+ * @param other The iterator to compare with the current one.
+ * @return bool True if both iterators point to the same node, otherwise false.
+ */
+template <typename T>
+bool ConcurrentIterator<T>::operator==(const ConcurrentIterator& other) const {
+    return data == other.data;
+}
+
+/**
+ * @brief Inequality comparison operator for iterators.
+ *
+ * @param other The iterator to compare with the current one.
+ * @return bool True if both iterators point to different nodes, otherwise false.
+ */
+template <typename T>
+bool ConcurrentIterator<T>::operator!=(const ConcurrentIterator& other) const {
+    return data != other.data;
+}
\ No newline at end of file
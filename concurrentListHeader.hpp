@@ -0,0 +1,86 @@
+#ifndef CONCURRENT_LIST_H
+#define CONCURRENT_LIST_H
+
+#include "concurrentIteratorHeader.hpp"
+#include <stdexcept>
+#include <utility>
+
+template <typename T>
+class ConcurrentNode : public ConcurrentLink {
+private:
+    T m_data;
+public:
+    template <typename... Args>
+    explicit ConcurrentNode(Args&&...);
+
+    friend class concurrentForwardList<T>;
+    friend class ConcurrentIterator<T>;
+    friend class ConcurrentIterator<const T>;
+};
+
+// Lock-free singly linked list that can be shared between threads without
+// a mutex. Insertions link a node with a single compare-and-swap; erasing
+// first marks the victim's next link (logical delete, after which no node
+// can be linked behind it) and then unlinks it (physical delete), as in
+// Harris' list. Unlinked nodes are reclaimed through epochDomain, so
+// iterators held by other threads never see freed memory.
+//
+// Operations that target a position return false if the node at that
+// position has been erased concurrently. size() is exact when the list
+// is quiescent and approximate while other threads modify it. The
+// destructor must not race with other operations.
+template <typename T>
+class concurrentForwardList {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using iterator = ConcurrentIterator<T>;
+    using const_iterator = ConcurrentIterator<const T>;
+
+public:
+    concurrentForwardList();
+    ~concurrentForwardList();
+    concurrentForwardList(const concurrentForwardList&) = delete;
+    concurrentForwardList& operator=(const concurrentForwardList&) = delete;
+
+    void push_front(const T&);
+    void push_front(T&&);
+
+    template <typename... Args>
+    void emplace_front(Args&&...);
+
+    bool insert_after(const_iterator, const T&);
+    bool insert_after(const_iterator, T&&);
+
+    template <typename... Args>
+    bool emplace_after(const_iterator, Args&&...);
+
+    bool erase_after(const_iterator);
+    void purge();
+    void clear();
+    iterator before_begin();
+    iterator begin();
+    iterator end();
+    const_iterator cbefore_begin() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    bool empty() const;
+    size_type size() const noexcept;
+
+private:
+    using node_type = ConcurrentNode<T>;
+
+    bool link_after(ConcurrentLink*, node_type*);
+    bool unlink(ConcurrentLink*, std::uintptr_t, ConcurrentLink*, std::uintptr_t);
+    static void delete_node(void*);
+
+    mutable ConcurrentLink m_head;
+    std::atomic<size_type> m_size;
+};
+
+#include "concurrentListImplementation.tpp"
+
+#endif
\ No newline at end of file
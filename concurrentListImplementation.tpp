@@ -0,0 +1,302 @@
+#include "concurrentListHeader.hpp"
+
+// -----------------------------------------------------------
+// ConcurrentNode Constructor - Forwards the arguments to the
+// element's constructor. The node starts unlinked and unmarked.
+// -----------------------------------------------------------
+template <typename T>
+template <typename... Args>
+ConcurrentNode<T>::ConcurrentNode(Args&&... args) : ConcurrentLink(), m_data(std::forward<Args>(args)...) { }
+
+
+// -----------------------------------------------------------
+// concurrentForwardList Constructor - Initializes an empty list:
+// the head sentinel links to nothing.
+// -----------------------------------------------------------
+template <typename T>
+concurrentForwardList<T>::concurrentForwardList() : m_head(), m_size(0) { }
+
+
+// -----------------------------------------------------------
+// Destructor - Deletes every node still linked, including erased
+// nodes that were not unlinked yet. Nodes already unlinked belong
+// to the reclamation domain and are freed by it.
+// -----------------------------------------------------------
+template <typename T>
+concurrentForwardList<T>::~concurrentForwardList() {
+    ConcurrentLink* current = ConcurrentLink::pointer(m_head.m_next.load(std::memory_order_acquire));
+    while (current) {
+        ConcurrentLink* next = ConcurrentLink::pointer(current->m_next.load(std::memory_order_relaxed));
+        delete static_cast<node_type*>(current);
+        current = next;
+    }
+}
+
+
+// -----------------------------------------------------------
+// push_front - Adds an element at the front of the list. The head
+// sentinel is never erased, so this always succeeds.
+// -----------------------------------------------------------
+template <typename T>
+void concurrentForwardList<T>::push_front(const T& data) {
+    emplace_after(cbefore_begin(), data);
+}
+
+template <typename T>
+void concurrentForwardList<T>::push_front(T&& data) {
+    emplace_after(cbefore_begin(), std::move(data));
+}
+
+
+// -----------------------------------------------------------
+// emplace_front - Constructs an element at the front of the list.
+// -----------------------------------------------------------
+template <typename T>
+template <typename... Args>
+void concurrentForwardList<T>::emplace_front(Args&&... args) {
+    emplace_after(cbefore_begin(), std::forward<Args>(args)...);
+}
+
+
+// -----------------------------------------------------------
+// insert_after - Inserts a copy (or moves) the given value right
+// after pos. Returns false if pos was erased concurrently, in which
+// case nothing is inserted.
+// -----------------------------------------------------------
+template <typename T>
+bool concurrentForwardList<T>::insert_after(const_iterator pos, const T& data) {
+    return emplace_after(pos, data);
+}
+
+template <typename T>
+bool concurrentForwardList<T>::insert_after(const_iterator pos, T&& data) {
+    return emplace_after(pos, std::move(data));
+}
+
+
+// -----------------------------------------------------------
+// emplace_after - Constructs an element and links it right after
+// pos. Throws if pos is the end iterator; returns false if pos was
+// erased concurrently.
+// -----------------------------------------------------------
+template <typename T>
+template <typename... Args>
+bool concurrentForwardList<T>::emplace_after(const_iterator pos, Args&&... args) {
+    if (!pos.data) {
+        throw std::invalid_argument("Cannot insert after the end iterator");
+    }
+    node_type* node = new node_type(std::forward<Args>(args)...);
+    if (!link_after(pos.data, node)) {
+        delete node;
+        return false;
+    }
+    return true;
+}
+
+
+// -----------------------------------------------------------
+// erase_after - Erases the element following pos. The element is
+// first marked as erased, which is the point where the erase takes
+// effect, and then unlinked. Erased elements found on the way are
+// unlinked first, so two concurrent erase_after(pos) calls remove
+// two different elements. Returns false if there is nothing after
+// pos or pos was erased concurrently.
+// -----------------------------------------------------------
+template <typename T>
+bool concurrentForwardList<T>::erase_after(const_iterator pos) {
+    if (!pos.data) {
+        throw std::invalid_argument("Cannot erase after the end iterator");
+    }
+    epochGuard guard;
+    ConcurrentLink* pred = pos.data;
+    for (;;) {
+        std::uintptr_t predNext = pred->m_next.load(std::memory_order_acquire);
+        if (ConcurrentLink::marked(predNext)) {
+            return false;
+        }
+        ConcurrentLink* victim = ConcurrentLink::pointer(predNext);
+        if (!victim) {
+            return false;
+        }
+        std::uintptr_t victimNext = victim->m_next.load(std::memory_order_acquire);
+        if (ConcurrentLink::marked(victimNext)) {
+            unlink(pred, predNext, victim, victimNext);
+            continue;
+        }
+        if (victim->m_next.compare_exchange_strong(victimNext, victimNext | 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            m_size.fetch_sub(1, std::memory_order_relaxed);
+            unlink(pred, predNext, victim, victimNext | 1);
+            return true;
+        }
+    }
+}
+
+
+// -----------------------------------------------------------
+// purge - Walks the whole list and unlinks every erased node that
+// is still linked, e.g. because a node was inserted in front of it
+// while it was being erased. Safe to call concurrently.
+// -----------------------------------------------------------
+template <typename T>
+void concurrentForwardList<T>::purge() {
+    epochGuard guard;
+retry:
+    ConcurrentLink* pred = &m_head;
+    for (;;) {
+        std::uintptr_t predNext = pred->m_next.load(std::memory_order_acquire);
+        if (ConcurrentLink::marked(predNext)) {
+            goto retry;
+        }
+        ConcurrentLink* current = ConcurrentLink::pointer(predNext);
+        if (!current) {
+            return;
+        }
+        std::uintptr_t currentNext = current->m_next.load(std::memory_order_acquire);
+        if (ConcurrentLink::marked(currentNext)) {
+            if (!unlink(pred, predNext, current, currentNext)) {
+                goto retry;
+            }
+            continue;
+        }
+        pred = current;
+    }
+}
+
+
+// -----------------------------------------------------------
+// clear - Erases elements from the front until the list is seen
+// empty. Elements inserted concurrently may survive.
+// -----------------------------------------------------------
+template <typename T>
+void concurrentForwardList<T>::clear() {
+    while (erase_after(cbefore_begin())) { }
+    purge();
+}
+
+
+// -----------------------------------------------------------
+// before_begin - Returns an iterator to the head sentinel, the
+// position to insert or erase after at the front of the list.
+// -----------------------------------------------------------
+template <typename T>
+typename concurrentForwardList<T>::iterator concurrentForwardList<T>::before_begin() {
+    return iterator(&m_head, epochGuard());
+}
+
+
+// -----------------------------------------------------------
+// begin - Returns an iterator to the first element not erased.
+// The epoch is pinned before the head link is read.
+// -----------------------------------------------------------
+template <typename T>
+typename concurrentForwardList<T>::iterator concurrentForwardList<T>::begin() {
+    iterator it(&m_head, epochGuard());
+    ++it;
+    return it;
+}
+
+
+// -----------------------------------------------------------
+// end - Returns the past-the-end iterator. It pins nothing.
+// -----------------------------------------------------------
+template <typename T>
+typename concurrentForwardList<T>::iterator concurrentForwardList<T>::end() {
+    return iterator();
+}
+
+
+// -----------------------------------------------------------
+// cbefore_begin / cbegin / cend - Constant versions of the above.
+// -----------------------------------------------------------
+template <typename T>
+typename concurrentForwardList<T>::const_iterator concurrentForwardList<T>::cbefore_begin() const {
+    return const_iterator(&m_head, epochGuard());
+}
+
+template <typename T>
+typename concurrentForwardList<T>::const_iterator concurrentForwardList<T>::cbegin() const {
+    const_iterator it(&m_head, epochGuard());
+    ++it;
+    return it;
+}
+
+template <typename T>
+typename concurrentForwardList<T>::const_iterator concurrentForwardList<T>::cend() const {
+    return const_iterator();
+}
+
+
+// -----------------------------------------------------------
+// empty - Checks whether the list currently holds no element that
+// has not been erased.
+// -----------------------------------------------------------
+template <typename T>
+bool concurrentForwardList<T>::empty() const {
+    return cbegin() == cend();
+}
+
+
+// -----------------------------------------------------------
+// size - Returns the number of elements. Exact on a quiescent
+// list, a snapshot of a moving target otherwise.
+// -----------------------------------------------------------
+template <typename T>
+typename concurrentForwardList<T>::size_type concurrentForwardList<T>::size() const noexcept {
+    return m_size.load(std::memory_order_relaxed);
+}
+
+
+// -----------------------------------------------------------
+// link_after - Links a new node right after pred with one CAS. An
+// erased successor is unlinked first rather than hidden behind the
+// new node. Fails if pred itself has been erased.
+// -----------------------------------------------------------
+template <typename T>
+bool concurrentForwardList<T>::link_after(ConcurrentLink* pred, node_type* node) {
+    epochGuard guard;
+    for (;;) {
+        std::uintptr_t predNext = pred->m_next.load(std::memory_order_acquire);
+        if (ConcurrentLink::marked(predNext)) {
+            return false;
+        }
+        ConcurrentLink* successor = ConcurrentLink::pointer(predNext);
+        if (successor) {
+            std::uintptr_t successorNext = successor->m_next.load(std::memory_order_acquire);
+            if (ConcurrentLink::marked(successorNext)) {
+                unlink(pred, predNext, successor, successorNext);
+                continue;
+            }
+        }
+        node->m_next.store(predNext, std::memory_order_relaxed);
+        if (pred->m_next.compare_exchange_weak(predNext, reinterpret_cast<std::uintptr_t>(node), std::memory_order_release, std::memory_order_relaxed)) {
+            m_size.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+}
+
+
+// -----------------------------------------------------------
+// unlink - Physically removes the erased node victim from behind
+// pred, provided pred still links to it (predNext) and is not erased
+// itself. The thread whose CAS succeeds retires the node, so every
+// node is retired exactly once.
+// -----------------------------------------------------------
+template <typename T>
+bool concurrentForwardList<T>::unlink(ConcurrentLink* pred, std::uintptr_t predNext, ConcurrentLink* victim, std::uintptr_t victimNext) {
+    std::uintptr_t successor = victimNext & ~std::uintptr_t(1);
+    if (!pred->m_next.compare_exchange_strong(predNext, successor, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        return false;
+    }
+    epochDomain::instance().retire(static_cast<node_type*>(victim), &concurrentForwardList<T>::delete_node);
+    return true;
+}
+
+
+// -----------------------------------------------------------
+// delete_node - Deleter handed to the reclamation domain.
+// -----------------------------------------------------------
+template <typename T>
+void concurrentForwardList<T>::delete_node(void* node) {
+    delete static_cast<node_type*>(node);
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#ifndef EPOCH_RECLAMATION_H
+#define EPOCH_RECLAMATION_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Epoch-based memory reclamation shared by the lock-free containers.
+//
+// A thread "pins" the current global epoch before it reads shared nodes
+// and unpins when done. A node unlinked while the global epoch is e is
+// retired instead of freed, and is only freed once the global epoch has
+// reached e + 2: the epoch can only advance when every pinned thread has
+// seen the current one, so by then no thread can still hold a reference.
+class epochDomain {
+public:
+    using deleter_type = void (*)(void*);
+
+    static epochDomain& instance();
+
+    ~epochDomain();
+    epochDomain(const epochDomain&) = delete;
+    epochDomain& operator=(const epochDomain&) = delete;
+
+    void enter();
+    void leave();
+    void retire(void*, deleter_type);
+    void collect();
+
+private:
+    static constexpr std::uint64_t s_inactive = ~std::uint64_t(0);
+    static constexpr std::size_t s_collectInterval = 64;
+
+    struct Retired {
+        void* m_ptr;
+        deleter_type m_deleter;
+        std::uint64_t m_epoch;
+    };
+
+    struct Record {
+        std::atomic<std::uint64_t> m_epoch{s_inactive};
+        std::atomic<bool> m_inUse{true};
+        Record* m_next = nullptr;
+        std::size_t m_nesting = 0;
+        std::vector<Retired> m_retired;
+    };
+
+    struct ThreadHandle {
+        Record* m_record = nullptr;
+        ~ThreadHandle();
+    };
+
+    epochDomain();
+
+    Record& local_record();
+    Record* acquire_record();
+    bool try_advance();
+    void reclaim(Record&);
+
+    std::atomic<std::uint64_t> m_globalEpoch;
+    std::atomic<Record*> m_records;
+};
+
+// RAII pin of the calling thread's epoch. While at least one guard is
+// alive on a thread, nodes that thread can reach are not freed. Guards
+// nest, are copyable (a copy pins again) and must stay on the thread
+// that created them.
+class epochGuard {
+public:
+    epochGuard();
+    explicit epochGuard(std::defer_lock_t) noexcept;
+    epochGuard(const epochGuard&);
+    epochGuard(epochGuard&&) noexcept;
+    epochGuard& operator=(const epochGuard&);
+    epochGuard& operator=(epochGuard&&) noexcept;
+    ~epochGuard();
+
+    void release() noexcept;
+    bool active() const noexcept;
+
+private:
+    bool m_active;
+};
+
+#include "epochReclamationImplementation.tpp"
+
+#endif
\ No newline at end of file
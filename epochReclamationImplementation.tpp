@@ -0,0 +1,256 @@
+#include "epochReclamationHeader.hpp"
+
+// -----------------------------------------------------------
+// instance - Returns the process-wide reclamation domain shared
+// by all lock-free containers.
+// -----------------------------------------------------------
+inline epochDomain& epochDomain::instance() {
+    static epochDomain domain;
+    return domain;
+}
+
+
+// -----------------------------------------------------------
+// epochDomain Constructor - Starts at epoch 0 with no registered
+// threads.
+// -----------------------------------------------------------
+inline epochDomain::epochDomain() : m_globalEpoch(0), m_records(nullptr) { }
+
+
+// -----------------------------------------------------------
+// epochDomain Destructor - Runs at program exit, when no thread
+// can be pinned anymore, and frees everything still retired.
+// -----------------------------------------------------------
+inline epochDomain::~epochDomain() {
+    Record* record = m_records.load(std::memory_order_acquire);
+    while (record) {
+        for (const Retired& retired : record->m_retired) {
+            retired.m_deleter(retired.m_ptr);
+        }
+        Record* next = record->m_next;
+        delete record;
+        record = next;
+    }
+}
+
+
+// -----------------------------------------------------------
+// enter - Pins the current global epoch for the calling thread.
+// Nested calls only bump a counter. The announcement is sequentially
+// consistent so that it is visible before any shared node is read.
+// -----------------------------------------------------------
+inline void epochDomain::enter() {
+    Record& record = local_record();
+    if (record.m_nesting++ == 0) {
+        record.m_epoch.store(m_globalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+
+// -----------------------------------------------------------
+// leave - Undoes one enter(). The outermost call marks the thread
+// as inactive, so it no longer holds the epoch back.
+// -----------------------------------------------------------
+inline void epochDomain::leave() {
+    Record& record = local_record();
+    if (--record.m_nesting == 0) {
+        record.m_epoch.store(s_inactive, std::memory_order_release);
+    }
+}
+
+
+// -----------------------------------------------------------
+// retire - Hands an unlinked node over for deferred deletion. Must
+// be called while pinned. Every few retirements the thread tries to
+// advance the epoch and frees whatever has become safe.
+// -----------------------------------------------------------
+inline void epochDomain::retire(void* ptr, deleter_type deleter) {
+    Record& record = local_record();
+    record.m_retired.push_back(Retired{ptr, deleter, m_globalEpoch.load(std::memory_order_acquire)});
+    if (record.m_retired.size() % s_collectInterval == 0) {
+        collect();
+    }
+}
+
+
+// -----------------------------------------------------------
+// collect - Tries to advance the global epoch and frees the calling
+// thread's retired nodes that no other thread can reach anymore.
+// -----------------------------------------------------------
+inline void epochDomain::collect() {
+    try_advance();
+    reclaim(local_record());
+}
+
+
+// -----------------------------------------------------------
+// ThreadHandle Destructor - Gives the thread's record back when the
+// thread exits. Its pending retirements stay in the record and are
+// freed by the next thread that adopts it, or at program exit.
+// -----------------------------------------------------------
+inline epochDomain::ThreadHandle::~ThreadHandle() {
+    if (m_record) {
+        m_record->m_nesting = 0;
+        m_record->m_epoch.store(s_inactive, std::memory_order_release);
+        m_record->m_inUse.store(false, std::memory_order_release);
+    }
+}
+
+
+// -----------------------------------------------------------
+// local_record - Returns the calling thread's record, registering
+// the thread on first use.
+// -----------------------------------------------------------
+inline epochDomain::Record& epochDomain::local_record() {
+    thread_local ThreadHandle handle;
+    if (!handle.m_record) {
+        handle.m_record = acquire_record();
+    }
+    return *handle.m_record;
+}
+
+
+// -----------------------------------------------------------
+// acquire_record - Adopts a record left behind by an exited thread,
+// or pushes a new one onto the lock-free registry. Records are never
+// removed, so the registry can be walked without synchronization.
+// -----------------------------------------------------------
+inline epochDomain::Record* epochDomain::acquire_record() {
+    for (Record* record = m_records.load(std::memory_order_acquire); record; record = record->m_next) {
+        bool expected = false;
+        if (!record->m_inUse.load(std::memory_order_relaxed) &&
+            record->m_inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            return record;
+        }
+    }
+
+    Record* record = new Record();
+    Record* head = m_records.load(std::memory_order_relaxed);
+    do {
+        record->m_next = head;
+    } while (!m_records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+    return record;
+}
+
+
+// -----------------------------------------------------------
+// try_advance - Moves the global epoch forward by one if every
+// pinned thread has already observed the current epoch.
+// -----------------------------------------------------------
+inline bool epochDomain::try_advance() {
+    std::uint64_t epoch = m_globalEpoch.load(std::memory_order_seq_cst);
+    for (Record* record = m_records.load(std::memory_order_acquire); record; record = record->m_next) {
+        std::uint64_t local = record->m_epoch.load(std::memory_order_seq_cst);
+        if (local != s_inactive && local != epoch) {
+            return false;
+        }
+    }
+    return m_globalEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+}
+
+
+// -----------------------------------------------------------
+// reclaim - Frees the retired nodes of a record that were retired
+// at least two epochs ago, keeping the others in order.
+// -----------------------------------------------------------
+inline void epochDomain::reclaim(Record& record) {
+    std::uint64_t epoch = m_globalEpoch.load(std::memory_order_acquire);
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < record.m_retired.size(); ++i) {
+        Retired retired = record.m_retired[i];
+        if (retired.m_epoch + 2 <= epoch) {
+            retired.m_deleter(retired.m_ptr);
+        }
+        else {
+            record.m_retired[kept++] = retired;
+        }
+    }
+    record.m_retired.resize(kept);
+}
+
+
+// -----------------------------------------------------------
+// epochGuard Constructor - Pins the calling thread.
+// -----------------------------------------------------------
+inline epochGuard::epochGuard() : m_active(true) {
+    epochDomain::instance().enter();
+}
+
+
+// -----------------------------------------------------------
+// epochGuard Constructor (Deferred) - Creates a guard that does not
+// pin anything, e.g. for end iterators.
+// -----------------------------------------------------------
+inline epochGuard::epochGuard(std::defer_lock_t) noexcept : m_active(false) { }
+
+
+// -----------------------------------------------------------
+// epochGuard Constructor (Copy) - Pins again if the other guard is
+// active, so that both guards can be released independently.
+// -----------------------------------------------------------
+inline epochGuard::epochGuard(const epochGuard& other) : m_active(other.m_active) {
+    if (m_active) {
+        epochDomain::instance().enter();
+    }
+}
+
+
+// -----------------------------------------------------------
+// epochGuard Constructor (Move) - Takes over the other guard's pin.
+// -----------------------------------------------------------
+inline epochGuard::epochGuard(epochGuard&& other) noexcept : m_active(other.m_active) {
+    other.m_active = false;
+}
+
+
+// -----------------------------------------------------------
+// Assignment Operators - Release the current pin (if any) and take
+// on the state of the other guard.
+// -----------------------------------------------------------
+inline epochGuard& epochGuard::operator=(const epochGuard& other) {
+    if (this != &other && !(m_active && other.m_active)) {
+        if (other.m_active) {
+            epochDomain::instance().enter();
+        }
+        release();
+        m_active = other.m_active;
+    }
+    return *this;
+}
+
+inline epochGuard& epochGuard::operator=(epochGuard&& other) noexcept {
+    if (this != &other) {
+        release();
+        m_active = other.m_active;
+        other.m_active = false;
+    }
+    return *this;
+}
+
+
+// -----------------------------------------------------------
+// epochGuard Destructor - Unpins if the guard is still active.
+// -----------------------------------------------------------
+inline epochGuard::~epochGuard() {
+    release();
+}
+
+
+// -----------------------------------------------------------
+// release - Unpins early; the guard becomes inactive.
+// -----------------------------------------------------------
+inline void epochGuard::release() noexcept {
+    if (m_active) {
+        m_active = false;
+        epochDomain::instance().leave();
+    }
+}
+
+
+// -----------------------------------------------------------
+// active - Checks whether the guard currently pins the thread.
+// -----------------------------------------------------------
+inline bool epochGuard::active() const noexcept {
+    return m_active;
+}
\ No newline at end of file
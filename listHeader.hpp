@@ -2,10 +2,42 @@
 #define LIST_H
 
 #include "listIteratorHeader.hpp"
+#include "nodePoolHeader.hpp"
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <system_error>
+#include <thread>
+#include <vector>
 
-template <typename T>
+// When set to 0, forwardList does not keep a pointer to its last node.
+// This saves one pointer per list, at the cost of push_back, append and
+// splice_after walking to the end of the list again.
+//
+// The setting changes the layout of forwardList, so every translation
+// unit of a program must be compiled with the same value. Mixing them is
+// an ODR violation that neither the compiler nor the linker reports. Set
+// it for the whole program (e.g. with target_compile_definitions on the
+// executable), never per file. The forward-list-tests-notail target runs
+// the tests in this configuration.
+#ifndef FORWARD_LIST_TAIL_POINTER
+#define FORWARD_LIST_TAIL_POINTER 1
+#endif
+
+template <typename T, typename Allocator = std::allocator<T>>
 class forwardList;
 
+// Detects input iterators, so that range overloads such as
+// forwardList(first, last) do not capture calls like forwardList(5, 1).
+template <typename It, typename = void>
+struct isInputIterator : std::false_type { };
+
+template <typename It>
+struct isInputIterator<It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+    : std::is_convertible<typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag> { };
+
 template <typename T>
 class Node {
 private:
@@ -17,14 +49,17 @@ public:
 
     template<typename... Args>
     Node(Args&&...);
-    friend class forwardList<T>;
+    template <typename, typename>
+    friend class forwardList;
     friend class Iterator<T>;
+    friend class Iterator<const T>;
 };
 
-template <typename T>
+template <typename T, typename Allocator>
 class forwardList {
 public:
     using value_type = T;
+    using allocator_type = Allocator;
     using size_type = std::size_t;
     using difference_type = std::ptrdiff_t;
     using refermce = value_type&;
@@ -34,12 +69,31 @@ public:
 
 public:
     forwardList();
-    forwardList(size_type, const T&);
-    explicit forwardList(size_type);
+    explicit forwardList(const Allocator&);
+    forwardList(size_type, const T&, const Allocator& = Allocator());
+    explicit forwardList(size_type, const Allocator& = Allocator());
+
+    template <typename InputIt, typename = typename std::enable_if<isInputIterator<InputIt>::value>::type>
+    forwardList(InputIt, InputIt, const Allocator& = Allocator());
+
+    forwardList(std::initializer_list<T>, const Allocator& = Allocator());
     ~forwardList();
     forwardList(const forwardList&);
+    forwardList(forwardList&&) noexcept;
     forwardList& operator=(const forwardList&);
-    void insert_after(Node<T>*, T);
+    forwardList& operator=(forwardList&&);
+    forwardList& operator=(std::initializer_list<T>);
+
+    template <typename InputIt, typename = typename std::enable_if<isInputIterator<InputIt>::value>::type>
+    void assign(InputIt, InputIt);
+
+    template <typename InputIt, typename = typename std::enable_if<isInputIterator<InputIt>::value>::type>
+    void assign(InputIt, InputIt, size_type);
+
+    void assign(size_type, const T&);
+    void assign(std::initializer_list<T>);
+    void insert_after(Node<T>*, const T&);
+    void insert_after(Node<T>*, T&&);
 
     template  <typename... Args>
     iterator emplace_after(iterator, Args&&...);
@@ -48,7 +102,13 @@ public:
     iterator insert_range_after(const_iterator, InputIt, InputIt);
 
     void erase_after(Node<T>*);
-    void push_front(T);
+    void push_front(const T&);
+    void push_front(T&&);
+    void push_back(const T&);
+    void push_back(T&&);
+
+    template <typename... Args>
+    void emplace_back(Args&&...);
 
     template <typename... Args>
     void emplace_front(Args&&...);
@@ -59,15 +119,102 @@ public:
     void resize(size_type, const T& value = T());
     void swap(forwardList&);
     void merge(const forwardList&);
+    void merge(forwardList&&);
+
+    template <typename Compare>
+    void merge(const forwardList&, Compare);
+
+    template <typename Compare>
+    void merge(forwardList&&, Compare);
+
+    void sort();
+
+    template <typename Compare>
+    void sort(Compare);
+
+    void parallel_sort(unsigned threads = 0);
+
+    template <typename Compare>
+    void parallel_sort(Compare, unsigned threads = 0);
+
+    size_type unique();
+
+    template <typename BinaryPredicate>
+    size_type unique(BinaryPredicate);
+
+    size_type remove(const T&);
+
+    template <typename Predicate>
+    size_type remove_if(Predicate);
+
+    void reverse() noexcept;
     void splice_after(iterator, forwardList&);
+    void splice_after(iterator, forwardList&&);
+    void splice_after(const_iterator, forwardList&, const_iterator);
+    void splice_after(const_iterator, forwardList&&, const_iterator);
+    void splice_after(const_iterator, forwardList&, const_iterator, const_iterator);
+    void splice_after(const_iterator, forwardList&&, const_iterator, const_iterator);
+    void append(forwardList&&);
     iterator begin();
     iterator end();
     const_iterator cbegin() const;
     const_iterator cend() const;
     bool empty() const;
+    size_type size() const noexcept;
+    void clear();
+    allocator_type get_allocator() const;
 
 private:
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node<T>>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    // A detached, null-terminated run of nodes with its last node.
+    struct Chain {
+        Node<T>* first = nullptr;
+        Node<T>* last = nullptr;
+    };
+
+    // parallel_sort does not split lists into segments smaller than this.
+    static constexpr size_type s_parallelSortGrain = 1 << 15;
+
+    template <typename... Args>
+    Node<T>* create_node(Args&&...);
+    void destroy_node(Node<T>*);
+    void copy_nodes(const forwardList&);
+
+    template <typename InputIt>
+    Chain build_chain(InputIt, InputIt, size_type&);
+
+    Chain build_chain(size_type, const T&);
+
+    template <typename InputIt>
+    void reserve_for(InputIt, InputIt);
+
+    void reserve_nodes(size_type);
+    void replace_nodes(Chain, size_type);
+    void link_back(Node<T>*);
+    void link_after(Node<T>*, Node<T>*, Node<T>*, size_type);
+    void steal(forwardList&) noexcept;
+
+    template <typename Compare>
+    static void merge_chains(Chain&, Chain, Compare&);
+
+    template <typename Compare>
+    static void sort_chain(Chain&, Compare&);
+
+    template <typename Task>
+    static void run_parallel(size_type, Task&);
+
+    void destroy_chain(Node<T>*);
+    Node<T>* tail_node() const;
+    void set_tail(Node<T>*);
+
     Node<T>* m_head;
+    node_allocator m_alloc;
+    size_type m_size = 0;
+#if FORWARD_LIST_TAIL_POINTER
+    Node<T>* m_tail = nullptr;
+#endif
 };
 
 #include "listImplementation.tpp"
@@ -32,24 +32,28 @@ Node<T>::Node(Args&&... args) : m_data(std::forward<Args>(args)...), m_next(null
 // forwardList Constructor (Default) - Initializes an empty
 // forwardList with a null head pointer, representing an empty list.
 // -----------------------------------------------------------
-template <typename T>
-forwardList<T>::forwardList() : m_head(nullptr) { }
+template <typename T, typename Allocator>
+forwardList<T, Allocator>::forwardList() : m_head(nullptr), m_alloc() { }
+
+
+// -----------------------------------------------------------
+// forwardList Constructor (Allocator) - Initializes an empty
+// forwardList whose nodes will be obtained from the given allocator
+// (rebound to Node<T>).
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+forwardList<T, Allocator>::forwardList(const Allocator& alloc) : m_head(nullptr), m_alloc(alloc) { }
 
 
 // -----------------------------------------------------------
 // forwardList Constructor (Count and Value) - Creates a forwardList
 // of a specific count, where each node is initialized with the same value.
-// It links the nodes together, forming a list of the given size.
+// The nodes are reserved in one batch when the allocator supports it.
 // -----------------------------------------------------------
-template <typename T>
-forwardList<T>::forwardList(size_type count, const T& value) {
-    m_head = nullptr;
-    Node<T>** current = &m_head;
-
-    for (size_type i = 0; i < count; ++i) {
-        *current = new Node<T>(value);
-        current = &(*current)->m_next;
-    }
+template <typename T, typename Allocator>
+forwardList<T, Allocator>::forwardList(size_type count, const T& value, const Allocator& alloc)
+    : m_head(nullptr), m_alloc(alloc) {
+    assign(count, value);
 }
 
 
@@ -58,41 +62,64 @@ forwardList<T>::forwardList(size_type count, const T& value) {
 // with the specified count, and the nodes are initialized with
 // a default constructed value (T()).
 // -----------------------------------------------------------
-template <typename T>
-forwardList<T>::forwardList(size_type count) : forwardList(count, T()) { }
+template <typename T, typename Allocator>
+forwardList<T, Allocator>::forwardList(size_type count, const Allocator& alloc) : forwardList(count, T(), alloc) { }
 
 
 // -----------------------------------------------------------
-// Destructor - Deallocates memory by traversing the list and
-// deleting each node. Ensures no memory leak when the list is destroyed.
+// forwardList Constructor (Range) - Creates a forwardList holding
+// copies of the elements in [first, last), in the same order.
 // -----------------------------------------------------------
-template <typename T>
-forwardList<T>::~forwardList() {
-    while (m_head) {
-        Node<T>* temp = m_head;
-        m_head = m_head->m_next;
-        delete temp;
-    }
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+forwardList<T, Allocator>::forwardList(InputIt first, InputIt last, const Allocator& alloc)
+    : m_head(nullptr), m_alloc(alloc) {
+    assign(first, last);
+}
+
+
+// -----------------------------------------------------------
+// forwardList Constructor (Initializer List) - Creates a forwardList
+// holding copies of the listed elements, e.g. forwardList<int>{1, 2, 3}.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+forwardList<T, Allocator>::forwardList(std::initializer_list<T> values, const Allocator& alloc)
+    : m_head(nullptr), m_alloc(alloc) {
+    assign(values.begin(), values.end());
+}
+
+
+// -----------------------------------------------------------
+// Destructor - Deallocates memory by clearing the list.
+// Ensures no memory leak when the list is destroyed.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+forwardList<T, Allocator>::~forwardList() {
+    clear();
 }
 
 
 // -----------------------------------------------------------
 // forwardList Constructor (Copy) - Creates a copy of the provided
 // forwardList. It allocates new memory for each node and copies over the data.
+// The allocator is obtained via select_on_container_copy_construction.
 // -----------------------------------------------------------
-template <typename T>
-forwardList<T>::forwardList(const forwardList<T>& other) : m_head(nullptr) {
-    if (other.m_head) {
-        m_head = new Node<T>(other.m_head->m_data);
-        Node<T>* current1 = m_head;
-        Node<T>* current2 = other.m_head->m_next;
-
-        while (current2) {
-            current1->m_next = new Node<T>(current2->m_data);
-            current1 = current1->m_next;  
-            current2 = current2->m_next;
-        }
-    }
+template <typename T, typename Allocator>
+forwardList<T, Allocator>::forwardList(const forwardList<T, Allocator>& other)
+    : m_head(nullptr), m_alloc(node_traits::select_on_container_copy_construction(other.m_alloc)) {
+    copy_nodes(other);
+}
+
+
+// -----------------------------------------------------------
+// forwardList Constructor (Move) - Takes over the nodes and the
+// allocator of the other list without allocating anything. The
+// other list is left empty.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+forwardList<T, Allocator>::forwardList(forwardList<T, Allocator>&& other) noexcept
+    : m_head(nullptr), m_alloc(std::move(other.m_alloc)) {
+    steal(other);
 }
 
 
@@ -101,42 +128,136 @@ forwardList<T>::forwardList(const forwardList<T>& other) : m_head(nullptr) {
 // forwardList. It first clears the current list, then allocates
 // new nodes and copies the data from the other list.
 // -----------------------------------------------------------
-template <typename T>
-forwardList<T>& forwardList<T>::operator=(const forwardList<T>& other) {
+template <typename T, typename Allocator>
+forwardList<T, Allocator>& forwardList<T, Allocator>::operator=(const forwardList<T, Allocator>& other) {
     if (this != &other) {  
-        while (m_head) {
-            Node<T>* tmp = m_head;
-            m_head = m_head->m_next;
-            delete tmp;
+        clear();
+        if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+            m_alloc = other.m_alloc;
         }
-        if (other.m_head) {
-            m_head = new Node<T>(other.m_head->m_data);
-            Node<T>* current1 = m_head;
-            Node<T>* current2 = other.m_head->m_next;
-
-            while (current2) {
-                current1->m_next = new Node<T>(current2->m_data);
-                current1 = current1->m_next;  
-                current2 = current2->m_next;
-            }
+        copy_nodes(other);
+    }
+    return *this;
+}
+
+
+// -----------------------------------------------------------
+// Move Assignment Operator - Releases the current nodes and takes
+// over the nodes of the other list. If the allocator does not
+// propagate and the two allocators differ, the nodes cannot change
+// owner, so the elements are moved one by one into new nodes.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+forwardList<T, Allocator>& forwardList<T, Allocator>::operator=(forwardList<T, Allocator>&& other) {
+    if (this == &other) {
+        return *this;
+    }
+    clear();
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+        m_alloc = std::move(other.m_alloc);
+        steal(other);
+    }
+    else {
+        if (node_traits::is_always_equal::value || m_alloc == other.m_alloc) {
+            steal(other);
+        }
+        else {
+            append(std::move(other));
         }
     }
     return *this;
 }
 
 
+// -----------------------------------------------------------
+// Assignment Operator (Initializer List) - Replaces the contents
+// with copies of the listed elements.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+forwardList<T, Allocator>& forwardList<T, Allocator>::operator=(std::initializer_list<T> values) {
+    assign(values.begin(), values.end());
+    return *this;
+}
+
+
+// -----------------------------------------------------------
+// assign (Range) - Replaces the contents with copies of the elements
+// in [first, last). The new nodes are built into a detached chain
+// first (reserved in one batch when the length is known and the
+// allocator supports it), so if a copy throws, the partial chain is
+// destroyed and the list is left unchanged. The range may refer to
+// elements of this list.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+void forwardList<T, Allocator>::assign(InputIt first, InputIt last) {
+    reserve_for(first, last);
+    size_type count = 0;
+    Chain chain = build_chain(first, last, count);
+    replace_nodes(chain, count);
+}
+
+
+// -----------------------------------------------------------
+// assign (Range and Count) - Same as assign (Range), for a range
+// whose length the caller already knows: count nodes are reserved
+// up front without walking the range to measure it, so a single
+// pass reads each element once. count only sizes the reservation;
+// the list takes however many elements the range holds.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+void forwardList<T, Allocator>::assign(InputIt first, InputIt last, size_type count) {
+    reserve_nodes(count);
+    size_type built = 0;
+    Chain chain = build_chain(first, last, built);
+    replace_nodes(chain, built);
+}
+
+
+// -----------------------------------------------------------
+// assign (Count and Value) - Replaces the contents with count
+// copies of value, with the same guarantee as assign (Range).
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::assign(size_type count, const T& value) {
+    reserve_nodes(count);
+    Chain chain = build_chain(count, value);
+    replace_nodes(chain, count);
+}
+
+
+// -----------------------------------------------------------
+// assign (Initializer List) - Replaces the contents with copies of
+// the listed elements.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::assign(std::initializer_list<T> values) {
+    assign(values.begin(), values.end());
+}
+
+
 // -----------------------------------------------------------
 // insert_after - Inserts a new node with the given data after
 // the specified node. Throws an exception if the node is null.
+// The rvalue overload moves the data into the node.
 // -----------------------------------------------------------
-template <typename T>
-void forwardList<T>::insert_after(Node<T>* node, T data) {
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::insert_after(Node<T>* node, const T& data) {
     if (!node) {
         throw std::invalid_argument("Cannot insert after a null node");
     }
-    Node<T>* new_node = new Node<T>(data);
-    new_node->m_next = node->m_next;
-    node->m_next = new_node;
+    Node<T>* new_node = create_node(data);
+    link_after(node, new_node, new_node, 1);
+}
+
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::insert_after(Node<T>* node, T&& data) {
+    if (!node) {
+        throw std::invalid_argument("Cannot insert after a null node");
+    }
+    Node<T>* new_node = create_node(std::move(data));
+    link_after(node, new_node, new_node, 1);
 }
 
 
@@ -145,12 +266,16 @@ void forwardList<T>::insert_after(Node<T>* node, T data) {
 // in the list. It forwards the arguments to construct the new node
 // in place, avoiding unnecessary copies.
 // -----------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template  <typename... Args>
-typename forwardList<T>::iterator forwardList<T>::emplace_after(typename forwardList<T>::iterator pos, Args&&... args) {
-    Node<T>* newNode = new Node<T>(std::forward<Args>(args)...);
+typename forwardList<T, Allocator>::iterator forwardList<T, Allocator>::emplace_after(typename forwardList<T, Allocator>::iterator pos, Args&&... args) {
+    Node<T>* newNode = create_node(std::forward<Args>(args)...);
     newNode->m_next = pos.data->m_next;
     pos.data->m_next = newNode;
+    if (!newNode->m_next) {
+        set_tail(newNode);
+    }
+    ++m_size;
     return iterator(newNode);
 }
 
@@ -158,20 +283,22 @@ typename forwardList<T>::iterator forwardList<T>::emplace_after(typename forward
 // -----------------------------------------------------------
 // insert_range_after - Inserts a range of nodes after the specified
 // position in the list. The range is provided by two input iterators.
+// The nodes are built into a detached chain first and then linked in
+// with a single pointer write, so if a copy throws, the list is left
+// unchanged. Returns an iterator to the last inserted element, or pos
+// if the range is empty.
 // -----------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template <typename InputIt>
-typename forwardList<T>::iterator forwardList<T>::insert_range_after(typename forwardList<T>::const_iterator pos, InputIt first, InputIt last) {
-    Node<T>* current = pos.data;
-    Node<T>* newNode = nullptr;
-    while (first != last) {
-        newNode = new Node<T>(*first);
-        newNode->m_next = current->m_next;
-        current->m_next = newNode;
-        current = newNode;
-        ++first;
+typename forwardList<T, Allocator>::iterator forwardList<T, Allocator>::insert_range_after(typename forwardList<T, Allocator>::const_iterator pos, InputIt first, InputIt last) {
+    reserve_for(first, last);
+    size_type count = 0;
+    Chain chain = build_chain(first, last, count);
+    if (!chain.first) {
+        return iterator(pos.data);
     }
-    return iterator(newNode);
+    link_after(pos.data, chain.first, chain.last, count);
+    return iterator(chain.last);
 }
 
 
@@ -179,25 +306,66 @@ typename forwardList<T>::iterator forwardList<T>::insert_range_after(typename fo
 // erase_after - Deletes the node following the given node.
 // Throws an exception if the provided node is null.
 // -----------------------------------------------------------
-template <typename T>
-void forwardList<T>::erase_after(Node<T>* node) {
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::erase_after(Node<T>* node) {
     if (!node) {
         throw std::invalid_argument("Cannot erase after a null node");
     }
-    delete node->m_next;
-    node->m_next = node->m_next->m_next;
+    Node<T>* victim = node->m_next;
+    if (!victim) {
+        return;
+    }
+    node->m_next = victim->m_next;
+    if (!node->m_next) {
+        set_tail(node);
+    }
+    destroy_node(victim);
+    --m_size;
 }
 
 
 // -----------------------------------------------------------
 // push_front - Adds a new node with the provided data at the front
 // of the list. The new node points to the current head of the list.
+// The rvalue overload moves the data into the node.
 // -----------------------------------------------------------
-template <typename T>
-void forwardList<T>::push_front(T data) {
-    Node<T>* newNode = new Node<T>(data);
-    newNode->m_next = m_head;
-    m_head = newNode;
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::push_front(const T& data) {
+    Node<T>* newNode = create_node(data);
+    link_after(nullptr, newNode, newNode, 1);
+}
+
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::push_front(T&& data) {
+    Node<T>* newNode = create_node(std::move(data));
+    link_after(nullptr, newNode, newNode, 1);
+}
+
+
+// -----------------------------------------------------------
+// push_back - Adds a new node with the provided data at the end
+// of the list. Constant time thanks to the tail pointer (linear
+// when FORWARD_LIST_TAIL_POINTER is 0).
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::push_back(const T& data) {
+    link_back(create_node(data));
+}
+
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::push_back(T&& data) {
+    link_back(create_node(std::move(data)));
+}
+
+
+// -----------------------------------------------------------
+// emplace_back - Emplaces a new node with the provided arguments
+// at the end of the list, constructing the element in place.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename... Args>
+void forwardList<T, Allocator>::emplace_back(Args&&... args) {
+    link_back(create_node(std::forward<Args>(args)...));
 }
 
 
@@ -206,40 +374,30 @@ void forwardList<T>::push_front(T data) {
 // at the front of the list. The node is constructed in place, 
 // avoiding any unnecessary copies.
 // -----------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void forwardList<T>::emplace_front(Args&&... args) {
-    Node<T>* newNode = new Node<T>(std::forward<Args>(args)...);
-    newNode->m_next = m_head;
-    m_head = newNode;
+void forwardList<T, Allocator>::emplace_front(Args&&... args) {
+    Node<T>* newNode = create_node(std::forward<Args>(args)...);
+    link_after(nullptr, newNode, newNode, 1);
 }
 
 
 // -----------------------------------------------------------
-// prepend_range - Adds a range of nodes at the front of the list.
-// The range is provided by two input iterators.
+// prepend_range - Adds a range of nodes at the front of the list,
+// keeping the order of the range. The range is provided by two input
+// iterators. Like insert_range_after, the list is left unchanged if a
+// copy throws. Returns an iterator to the new first element.
 // -----------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template <typename InputIt>
-typename forwardList<T>::iterator forwardList<T>::prepend_range(InputIt first, InputIt last) {
-    Node<T>* newHead = nullptr;
-    Node<T>* tail = nullptr;
-
-    for (auto it = first; it != last; ++it) {
-        Node<T>* newNode = new Node<T>(*it);
-        if (!newHead) {
-            newHead = newNode;
-            tail = newNode;
-        }
-        else {
-            newNode->m_next = newHead;
-            newHead = newNode;
-        }
-    }
-    if (tail) {
-        tail->m_next = m_head;
-        m_head  = newHead;
+typename forwardList<T, Allocator>::iterator forwardList<T, Allocator>::prepend_range(InputIt first, InputIt last) {
+    reserve_for(first, last);
+    size_type count = 0;
+    Chain chain = build_chain(first, last, count);
+    if (chain.first) {
+        link_after(nullptr, chain.first, chain.last, count);
     }
+    return begin();
 }
 
 
@@ -248,38 +406,32 @@ typename forwardList<T>::iterator forwardList<T>::prepend_range(InputIt first, I
 // it truncates the extra nodes. If the list is too short, it appends new 
 // nodes with the specified value to the end of the list.
 // -----------------------------------------------------------
-template <typename T>
-void forwardList<T>::resize(size_type count, const T& value) {
-    Node<T>* current = m_head;
-    typename forwardList<T>::size_type size = 0;
-
-    while (current && size < count) {
-        current = current->m_next;
-        ++size;
-    }
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::resize(size_type count, const T& value) {
+    if (count < m_size) {
+        Node<T>* last = nullptr;
+        Node<T>* current = m_head;
+        for (size_type i = 0; i < count; ++i) {
+            last = current;
+            current = current->m_next;
+        }
 
-    if (size == count) {
-        Node<T>* tmp = current->m_next;
-        current->m_next = nullptr;
-        while (tmp) {
-            Node<T>* next = tmp->m_next;
-            delete tmp;
-            tmp = next;
+        if (last) {
+            last->m_next = nullptr;
         }
-    } 
-    else {
-        Node<T>* last = current ? current : m_head;
-        while (size < count) {
-            Node<T>* newNode = new Node<T>(value);
-            if (last) {
-                last->m_next = newNode;
-            }
-            else {
-                m_head = newNode;
-            }
-            last = newNode;
-            ++size;
+        else {
+            m_head = nullptr;
         }
+        set_tail(last);
+        m_size = count;
+        destroy_chain(current);
+    } 
+    else if (count > m_size) {
+        // Build the missing nodes off-list, then link them after the tail
+        size_type missing = count - m_size;
+        reserve_nodes(missing);
+        Chain chain = build_chain(missing, value);
+        link_after(tail_node(), chain.first, chain.last, missing);
     }
 }
 
@@ -289,53 +441,324 @@ void forwardList<T>::resize(size_type count, const T& value) {
 // The head pointers are swapped, and the internal structures
 // of both lists are exchanged.
 // -----------------------------------------------------------
-template <typename T>
-void forwardList<T>::swap(forwardList<T>& other) {
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::swap(forwardList<T, Allocator>& other) {
     std::swap(m_head, other.m_head);
+    std::swap(m_size, other.m_size);
+#if FORWARD_LIST_TAIL_POINTER
+    std::swap(m_tail, other.m_tail);
+#endif
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+        std::swap(m_alloc, other.m_alloc);
+    }
 }
 
 
 // -----------------------------------------------------------
-// merge - Merges another forwardList into the current list.
-// If the current list is empty, the list is directly initialized 
-// with the elements from the other list. If not, the elements from
-// the other list are appended to the end of the current list.
+// merge - Merges a copy of another sorted list into this sorted
+// list, ordered by operator<. The other list is left unchanged.
 // -----------------------------------------------------------
-template <typename T>
-void forwardList<T>::merge(const forwardList& other) {
-    // If the other list is empty, there's nothing to merge
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::merge(const forwardList& other) {
+    merge(other, std::less<T>());
+}
+
+
+// -----------------------------------------------------------
+// merge (Move) - Merges the nodes of another sorted list into this
+// sorted list, ordered by operator<. The other list is left empty.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::merge(forwardList&& other) {
+    merge(std::move(other), std::less<T>());
+}
+
+
+// -----------------------------------------------------------
+// merge (Compare) - Same as merge, ordered by the given comparison.
+// The elements are copied into a temporary list first, so a failed
+// copy leaves this list untouched.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename Compare>
+void forwardList<T, Allocator>::merge(const forwardList& other, Compare comp) {
     if (!other.m_head) {
         return;
     }
-    
-    // If the current list is empty, copy the entire other list to it
+    forwardList<T, Allocator> copy(get_allocator());
+    copy.copy_nodes(other);
+    merge(std::move(copy), comp);
+}
+
+
+// -----------------------------------------------------------
+// merge (Move, Compare) - Merges two lists sorted by comp into one
+// sorted list by relinking the nodes; nothing is copied. The merge
+// is stable: of two equivalent elements, the one from this list
+// comes first. If the allocators differ, the elements are moved
+// into nodes of this list's allocator first. If comp throws, every
+// node ends up in this list in an unspecified order.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename Compare>
+void forwardList<T, Allocator>::merge(forwardList&& other, Compare comp) {
+    if (!other.m_head || &other == this) {
+        return;
+    }
+    if (!(node_traits::is_always_equal::value || m_alloc == other.m_alloc)) {
+        forwardList<T, Allocator> moved(get_allocator());
+        moved.append(std::move(other));
+        merge(std::move(moved), comp);
+        return;
+    }
+
+    Chain chain{m_head, tail_node()};
+    Chain later{other.m_head, other.tail_node()};
+    m_size += other.m_size;
+    other.m_head = nullptr;
+    other.m_size = 0;
+    other.set_tail(nullptr);
+
+    try {
+        merge_chains(chain, later, comp);
+    }
+    catch (...) {
+        m_head = chain.first;
+        set_tail(chain.last);
+        throw;
+    }
+    m_head = chain.first;
+    set_tail(chain.last);
+}
+
+
+// -----------------------------------------------------------
+// sort - Sorts the list with a stable, bottom-up merge sort. Only
+// the links are rewritten: the elements are neither copied nor
+// moved and nothing is allocated. Already sorted runs are merged
+// in constant time, so sorted input takes linear time. If comp
+// throws, the elements are kept in an unspecified order.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::sort() {
+    sort(std::less<T>());
+}
+
+template <typename T, typename Allocator>
+template <typename Compare>
+void forwardList<T, Allocator>::sort(Compare comp) {
+    if (m_size < 2) {
+        return;
+    }
+    Chain chain{m_head, nullptr};
+    try {
+        sort_chain(chain, comp);
+    }
+    catch (...) {
+        m_head = chain.first;
+        set_tail(chain.last);
+        throw;
+    }
+    m_head = chain.first;
+    set_tail(chain.last);
+}
+
+
+// -----------------------------------------------------------
+// parallel_sort - Sorts the list like sort, using up to the given
+// number of threads (by default one per hardware thread). The list
+// is cut into equal segments that are sorted concurrently and then
+// merged pairwise, also concurrently. Lists too short to benefit
+// are sorted on the calling thread. comp is copied for every task,
+// so it need not be thread-safe. The sort is stable.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::parallel_sort(unsigned threads) {
+    parallel_sort(std::less<T>(), threads);
+}
+
+template <typename T, typename Allocator>
+template <typename Compare>
+void forwardList<T, Allocator>::parallel_sort(Compare comp, unsigned threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    size_type segments = std::min<size_type>(threads, m_size / s_parallelSortGrain);
+    if (segments < 2) {
+        sort(comp);
+        return;
+    }
+
+    std::vector<Chain> runs(segments);
+    Node<T>* current = m_head;
+    for (size_type i = 0; i < segments; ++i) {
+        size_type length = m_size / segments + (i < m_size % segments ? 1 : 0);
+        runs[i].first = current;
+        for (size_type j = 1; j < length; ++j) {
+            current = current->m_next;
+        }
+        runs[i].last = current;
+        current = current->m_next;
+        runs[i].last->m_next = nullptr;
+    }
+
+    try {
+        auto sortRun = [&runs, &comp](size_type i) {
+            Compare local(comp);
+            sort_chain(runs[i], local);
+        };
+        run_parallel(segments, sortRun);
+
+        while (runs.size() > 1) {
+            auto mergePair = [&runs, &comp](size_type i) {
+                Compare local(comp);
+                Chain later = runs[2 * i + 1];
+                runs[2 * i + 1] = Chain();
+                merge_chains(runs[2 * i], later, local);
+            };
+            run_parallel(runs.size() / 2, mergePair);
+
+            size_type kept = 0;
+            for (size_type i = 0; i < runs.size(); i += 2) {
+                runs[kept++] = runs[i];
+            }
+            runs.resize(kept);
+        }
+    }
+    catch (...) {
+        // Relink all segments so that no node is lost
+        Chain chain;
+        for (const Chain& run : runs) {
+            if (!run.first) {
+                continue;
+            }
+            if (chain.last) {
+                chain.last->m_next = run.first;
+            }
+            else {
+                chain.first = run.first;
+            }
+            chain.last = run.last;
+        }
+        m_head = chain.first;
+        set_tail(chain.last);
+        throw;
+    }
+    m_head = runs[0].first;
+    set_tail(runs[0].last);
+}
+
+
+// -----------------------------------------------------------
+// unique - Removes every element equal to (or, with a predicate,
+// matching) the element kept before it, in a single pass. Returns
+// the number of removed elements. The removed nodes are destroyed
+// after the pass, so the predicate may safely refer to elements.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+typename forwardList<T, Allocator>::size_type forwardList<T, Allocator>::unique() {
+    return unique(std::equal_to<T>());
+}
+
+template <typename T, typename Allocator>
+template <typename BinaryPredicate>
+typename forwardList<T, Allocator>::size_type forwardList<T, Allocator>::unique(BinaryPredicate pred) {
     if (!m_head) {
-        m_head = new Node<T>(other.m_head->m_data);
-        Node<T>* current1 = m_head;
-        Node<T>* current2 = other.m_head->m_next;
-
-        // Traverse through the other list and copy its elements
-        while (current2) {
-            current1->m_next = new Node<T>(current2->m_data);
-            current1 = current1->m_next;
-            current2 = current2->m_next;
+        return 0;
+    }
+    Node<T>* kept = m_head;
+    Node<T>* removed = nullptr;
+    size_type count = 0;
+    try {
+        while (Node<T>* next = kept->m_next) {
+            if (pred(kept->m_data, next->m_data)) {
+                kept->m_next = next->m_next;
+                next->m_next = removed;
+                removed = next;
+                ++count;
+            }
+            else {
+                kept = next;
+            }
         }
-        return;
     }
-    
-    // If the current list is not empty, traverse to the end
-    Node<T>* current1 = m_head;
-    while (current1->m_next) {
-        current1 = current1->m_next;
+    catch (...) {
+        m_size -= count;
+        destroy_chain(removed);
+        throw;
     }
-    
-    // Append elements from the other list to the end of the current list
-    Node<T>* current2 = other.m_head;
-    while (current2) {
-        current1->m_next = new Node<T>(current2->m_data);
-        current2 = current2->m_next;
-        current1 = current1->m_next;
+    m_size -= count;
+    set_tail(kept);
+    destroy_chain(removed);
+    return count;
+}
+
+
+// -----------------------------------------------------------
+// remove - Removes every element equal to the given value. The value
+// may be an element of this list. Returns the number of removed
+// elements.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+typename forwardList<T, Allocator>::size_type forwardList<T, Allocator>::remove(const T& value) {
+    return remove_if([&value](const T& element) { return element == value; });
+}
+
+
+// -----------------------------------------------------------
+// remove_if - Removes every element for which the predicate returns
+// true, in a single pass. The removed nodes are destroyed after the
+// pass. Returns the number of removed elements.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename Predicate>
+typename forwardList<T, Allocator>::size_type forwardList<T, Allocator>::remove_if(Predicate pred) {
+    Node<T>** link = &m_head;
+    Node<T>* kept = nullptr;
+    Node<T>* removed = nullptr;
+    size_type count = 0;
+    try {
+        while (Node<T>* node = *link) {
+            if (pred(node->m_data)) {
+                *link = node->m_next;
+                node->m_next = removed;
+                removed = node;
+                ++count;
+            }
+            else {
+                kept = node;
+                link = &node->m_next;
+            }
+        }
+    }
+    catch (...) {
+        m_size -= count;
+        destroy_chain(removed);
+        throw;
+    }
+    m_size -= count;
+    set_tail(kept);
+    destroy_chain(removed);
+    return count;
+}
+
+
+// -----------------------------------------------------------
+// reverse - Reverses the order of the elements by turning every
+// link around in a single pass. The first node becomes the tail.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::reverse() noexcept {
+    Node<T>* previous = nullptr;
+    Node<T>* current = m_head;
+    set_tail(m_head);
+    while (current) {
+        Node<T>* next = current->m_next;
+        current->m_next = previous;
+        previous = current;
+        current = next;
     }
+    m_head = previous;
 }
 
 
@@ -343,36 +766,119 @@ void forwardList<T>::merge(const forwardList& other) {
 // splice_after - Splices (inserts) the entire other forwardList 
 // after the specified iterator position in the current list.
 // After splicing, the other list becomes empty, and its elements
-// are merged into the current list.
+// are merged into the current list. Both lists must use equal
+// allocators, since the nodes change owner without being copied.
 // -----------------------------------------------------------
-template <typename T>
-void forwardList<T>::splice_after(typename forwardList<T>::iterator pos, forwardList<T>& other) {
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::splice_after(typename forwardList<T, Allocator>::iterator pos, forwardList<T, Allocator>& other) {
     // If the other list is empty, there's nothing to splice
-    if (!other.m_head) {
+    if (!other.m_head || &other == this) {
         return;
     }
     
-    Node<T>* current1 = pos.data;
-    Node<T>* current2 = other.m_head;
-    
-    // If the specified position is valid, link the elements from the other list
-    if (current1) {
-        Node<T>* temp = current1->m_next;
-        current1->m_next = current2;
-
-        // Traverse to the end of the other list and link it back
-        while (current2->m_next) {
-            current2 = current2->m_next;
-        }
-        current2->m_next = temp;
-    }
-    // If the specified position is null (beginning of the list), just move the head
-    else {
-        m_head = other.m_head;
-    }
+    Node<T>* first = other.m_head;
+    Node<T>* last = other.tail_node();
+    size_type count = other.m_size;
 
     // After the operation, the other list is empty
     other.m_head = nullptr;
+    other.m_size = 0;
+    other.set_tail(nullptr);
+
+    // A null position (beginning of the list) prepends the elements
+    link_after(pos.data, first, last, count);
+}
+
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::splice_after(typename forwardList<T, Allocator>::iterator pos, forwardList<T, Allocator>&& other) {
+    splice_after(pos, other);
+}
+
+
+// -----------------------------------------------------------
+// splice_after (Single Element) - Moves the element following `it`
+// in the other list to after `pos` in this list. Only pointers are
+// rewritten; the element is neither copied nor reallocated. The
+// other list may be this list.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::splice_after(typename forwardList<T, Allocator>::const_iterator pos, forwardList<T, Allocator>& other, typename forwardList<T, Allocator>::const_iterator it) {
+    Node<T>* prev = it.data;
+    Node<T>* node = prev ? prev->m_next : nullptr;
+    if (!node || pos.data == prev || pos.data == node) {
+        return;
+    }
+
+    prev->m_next = node->m_next;
+    if (!prev->m_next) {
+        other.set_tail(prev);
+    }
+    --other.m_size;
+
+    link_after(pos.data, node, node, 1);
+}
+
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::splice_after(typename forwardList<T, Allocator>::const_iterator pos, forwardList<T, Allocator>&& other, typename forwardList<T, Allocator>::const_iterator it) {
+    splice_after(pos, other, it);
+}
+
+
+// -----------------------------------------------------------
+// splice_after (Range) - Moves the elements in the open range
+// (first, last) of the other list to after `pos` in this list.
+// Counting the moved elements takes one pass over the range;
+// the elements themselves are only relinked.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::splice_after(typename forwardList<T, Allocator>::const_iterator pos, forwardList<T, Allocator>& other, typename forwardList<T, Allocator>::const_iterator first, typename forwardList<T, Allocator>::const_iterator last) {
+    Node<T>* before = first.data;
+    if (!before || before->m_next == last.data) {
+        return;
+    }
+
+    Node<T>* rangeFirst = before->m_next;
+    Node<T>* rangeLast = rangeFirst;
+    size_type count = 1;
+    while (rangeLast->m_next != last.data) {
+        rangeLast = rangeLast->m_next;
+        ++count;
+    }
+
+    before->m_next = last.data;
+    if (!before->m_next) {
+        other.set_tail(before);
+    }
+    other.m_size -= count;
+
+    link_after(pos.data, rangeFirst, rangeLast, count);
+}
+
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::splice_after(typename forwardList<T, Allocator>::const_iterator pos, forwardList<T, Allocator>&& other, typename forwardList<T, Allocator>::const_iterator first, typename forwardList<T, Allocator>::const_iterator last) {
+    splice_after(pos, other, first, last);
+}
+
+
+// -----------------------------------------------------------
+// append - Moves all elements of the other list to the end of
+// this list. With equal allocators the nodes are relinked after
+// the tail in constant time; otherwise each element is moved into
+// a node of this list's allocator and the other list is cleared.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::append(forwardList<T, Allocator>&& other) {
+    if (!other.m_head || &other == this) {
+        return;
+    }
+    if (node_traits::is_always_equal::value || m_alloc == other.m_alloc) {
+        splice_after(iterator(tail_node()), other);
+        return;
+    }
+    for (Node<T>* current = other.m_head; current; current = current->m_next) {
+        link_back(create_node(std::move(current->m_data)));
+    }
+    other.clear();
 }
 
 
@@ -381,9 +887,9 @@ void forwardList<T>::splice_after(typename forwardList<T>::iterator pos, forward
 // the list. Useful for traversing or modifying the list from 
 // the start.
 // -----------------------------------------------------------
-template <typename T>
-typename forwardList<T>::iterator forwardList<T>::begin() {
-    return typename forwardList<T>::iterator(m_head);
+template <typename T, typename Allocator>
+typename forwardList<T, Allocator>::iterator forwardList<T, Allocator>::begin() {
+    return typename forwardList<T, Allocator>::iterator(m_head);
 }
 
 
@@ -392,9 +898,9 @@ typename forwardList<T>::iterator forwardList<T>::begin() {
 // the list. This iterator marks the boundary after the last element,
 // helping to know where the list ends.
 // -----------------------------------------------------------
-template <typename T>
-typename forwardList<T>::iterator forwardList<T>::end() {
-    return typename forwardList<T>::iterator(nullptr);
+template <typename T, typename Allocator>
+typename forwardList<T, Allocator>::iterator forwardList<T, Allocator>::end() {
+    return typename forwardList<T, Allocator>::iterator(nullptr);
 }
 
 
@@ -403,9 +909,9 @@ typename forwardList<T>::iterator forwardList<T>::end() {
 // element of the list. The constant iterator prevents modification
 // of the list while traversing it.
 // -----------------------------------------------------------
-template <typename T>
-typename forwardList<T>::const_iterator forwardList<T>::cbegin() const {
-    return typename forwardList<T>::const_iterator(m_head);
+template <typename T, typename Allocator>
+typename forwardList<T, Allocator>::const_iterator forwardList<T, Allocator>::cbegin() const {
+    return typename forwardList<T, Allocator>::const_iterator(m_head);
 }
 
 
@@ -414,9 +920,9 @@ typename forwardList<T>::const_iterator forwardList<T>::cbegin() const {
 // element of the list. This constant iterator ensures the list 
 // cannot be modified during iteration.
 // -----------------------------------------------------------
-template <typename T>
-typename forwardList<T>::const_iterator forwardList<T>::cend() const {
-    return typename forwardList<T>::const_iterator(nullptr);
+template <typename T, typename Allocator>
+typename forwardList<T, Allocator>::const_iterator forwardList<T, Allocator>::cend() const {
+    return typename forwardList<T, Allocator>::const_iterator(nullptr);
 }
 
 
@@ -425,7 +931,484 @@ typename forwardList<T>::const_iterator forwardList<T>::cend() const {
 // is empty (i.e., both begin and end iterators are the same),
 // otherwise, it returns false indicating that the list contains elements.
 // -----------------------------------------------------------
-template <typename T>
-bool forwardList<T>::empty() const {
-    return this->begin() == this->end();
+template <typename T, typename Allocator>
+bool forwardList<T, Allocator>::empty() const {
+    return this->cbegin() == this->cend();
+}
+
+
+// -----------------------------------------------------------
+// size - Returns the number of elements in the list. The count is
+// maintained by every operation, so this is constant time.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+typename forwardList<T, Allocator>::size_type forwardList<T, Allocator>::size() const noexcept {
+    return m_size;
+}
+
+
+// -----------------------------------------------------------
+// clear - Destroys every element and returns the nodes to the
+// allocator. When the elements need no destructor and the allocator
+// can drop its whole arena at once (poolAllocator), the nodes are
+// not visited at all and the chunks are freed in O(chunks).
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::clear() {
+    if constexpr (std::is_trivially_destructible<T>::value && hasBulkRelease<node_allocator>::value) {
+        if (m_alloc.release()) {
+            m_head = nullptr;
+            m_size = 0;
+            set_tail(nullptr);
+            return;
+        }
+    }
+    while (m_head) {
+        Node<T>* tmp = m_head;
+        m_head = m_head->m_next;
+        destroy_node(tmp);
+    }
+    m_size = 0;
+    set_tail(nullptr);
+}
+
+
+// -----------------------------------------------------------
+// get_allocator - Returns a copy of the allocator associated
+// with the list, rebound back to the element type.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+typename forwardList<T, Allocator>::allocator_type forwardList<T, Allocator>::get_allocator() const {
+    return allocator_type(m_alloc);
+}
+
+
+// -----------------------------------------------------------
+// create_node - Allocates a node through the node allocator and
+// constructs it in place from the given arguments. If the element's
+// constructor throws, the memory is handed back before rethrowing.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename... Args>
+Node<T>* forwardList<T, Allocator>::create_node(Args&&... args) {
+    Node<T>* node = node_traits::allocate(m_alloc, 1);
+    try {
+        node_traits::construct(m_alloc, node, std::forward<Args>(args)...);
+    }
+    catch (...) {
+        node_traits::deallocate(m_alloc, node, 1);
+        throw;
+    }
+    return node;
+}
+
+
+// -----------------------------------------------------------
+// destroy_node - Destroys a node and returns its memory to the
+// node allocator.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::destroy_node(Node<T>* node) {
+    node_traits::destroy(m_alloc, node);
+    node_traits::deallocate(m_alloc, node, 1);
+}
+
+
+// -----------------------------------------------------------
+// copy_nodes - Fills this (empty) list with a copy of every element
+// of the other list, reserving the nodes in one batch when the
+// allocator supports it. On failure the partial copy is released,
+// leaving this list empty.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::copy_nodes(const forwardList& other) {
+    reserve_nodes(other.m_size);
+    size_type count = 0;
+    Chain chain = build_chain(other.cbegin(), other.cend(), count);
+    m_head = chain.first;
+    m_size = count;
+    set_tail(chain.last);
+}
+
+
+// -----------------------------------------------------------
+// build_chain - Creates a detached, null-terminated chain of nodes
+// holding copies of the elements in [first, last), and stores their
+// number in count. If a copy throws, the nodes created so far are
+// destroyed before rethrowing.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename InputIt>
+typename forwardList<T, Allocator>::Chain forwardList<T, Allocator>::build_chain(InputIt first, InputIt last, size_type& count) {
+    Chain chain;
+    count = 0;
+    try {
+        for (; first != last; ++first) {
+            Node<T>* node = create_node(*first);
+            if (chain.last) {
+                chain.last->m_next = node;
+            }
+            else {
+                chain.first = node;
+            }
+            chain.last = node;
+            ++count;
+        }
+    }
+    catch (...) {
+        destroy_chain(chain.first);
+        throw;
+    }
+    return chain;
+}
+
+
+// -----------------------------------------------------------
+// build_chain (Count and Value) - Same as above for count copies
+// of value.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+typename forwardList<T, Allocator>::Chain forwardList<T, Allocator>::build_chain(size_type count, const T& value) {
+    Chain chain;
+    try {
+        for (size_type i = 0; i < count; ++i) {
+            Node<T>* node = create_node(value);
+            if (chain.last) {
+                chain.last->m_next = node;
+            }
+            else {
+                chain.first = node;
+            }
+            chain.last = node;
+        }
+    }
+    catch (...) {
+        destroy_chain(chain.first);
+        throw;
+    }
+    return chain;
+}
+
+
+// -----------------------------------------------------------
+// reserve_for - Reserves nodes for the range [first, last) when its
+// length can be measured without consuming it (forward iterators)
+// and the allocator can reserve. Otherwise it does nothing, so plain
+// allocators never pay for the extra pass over the range.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename InputIt>
+void forwardList<T, Allocator>::reserve_for([[maybe_unused]] InputIt first, [[maybe_unused]] InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (hasReserve<node_allocator>::value && std::is_convertible<category, std::forward_iterator_tag>::value) {
+        reserve_nodes(static_cast<size_type>(std::distance(first, last)));
+    }
+}
+
+
+// -----------------------------------------------------------
+// reserve_nodes - Asks the node allocator to set aside room for
+// count nodes in one batch, if it supports that (poolAllocator).
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::reserve_nodes([[maybe_unused]] size_type count) {
+    if constexpr (hasReserve<node_allocator>::value) {
+        if (count > 1) {
+            m_alloc.reserve(count);
+        }
+    }
+}
+
+
+// -----------------------------------------------------------
+// replace_nodes - Destroys the current nodes and installs the given
+// detached chain of count nodes instead. The old nodes are destroyed
+// one by one rather than through clear(), whose bulk release would
+// also free the new chain's memory.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::replace_nodes(Chain chain, size_type count) {
+    destroy_chain(m_head);
+    m_head = chain.first;
+    m_size = count;
+    set_tail(chain.last);
+}
+
+
+// -----------------------------------------------------------
+// link_back - Links an already created node after the last node
+// of the list and makes it the new tail.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::link_back(Node<T>* node) {
+    Node<T>* last = tail_node();
+    if (last) {
+        last->m_next = node;
+    }
+    else {
+        m_head = node;
+    }
+    set_tail(node);
+    ++m_size;
+}
+
+
+// -----------------------------------------------------------
+// link_after - Links the detached chain first..last (count nodes)
+// after the given node, or at the front of the list if the node is
+// null, updating the size and the tail.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::link_after(Node<T>* pos, Node<T>* first, Node<T>* last, size_type count) {
+    if (pos) {
+        last->m_next = pos->m_next;
+        pos->m_next = first;
+    }
+    else {
+        last->m_next = m_head;
+        m_head = first;
+    }
+    if (!last->m_next) {
+        set_tail(last);
+    }
+    m_size += count;
+}
+
+
+// -----------------------------------------------------------
+// steal - Takes over the nodes of the other list and leaves it
+// empty. This list must be empty and its allocator must be able
+// to free the other list's nodes.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::steal(forwardList& other) noexcept {
+    m_head = other.m_head;
+    m_size = other.m_size;
+#if FORWARD_LIST_TAIL_POINTER
+    m_tail = other.m_tail;
+#endif
+    other.m_head = nullptr;
+    other.m_size = 0;
+    other.set_tail(nullptr);
+}
+
+
+// -----------------------------------------------------------
+// tail_node - Returns the last node of the list, or nullptr if the
+// list is empty. Walks the list when the tail pointer is disabled.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+Node<T>* forwardList<T, Allocator>::tail_node() const {
+#if FORWARD_LIST_TAIL_POINTER
+    return m_tail;
+#else
+    Node<T>* current = m_head;
+    while (current && current->m_next) {
+        current = current->m_next;
+    }
+    return current;
+#endif
+}
+
+
+// -----------------------------------------------------------
+// set_tail - Records the new last node of the list. A no-op when
+// the tail pointer is disabled.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::set_tail([[maybe_unused]] Node<T>* node) {
+#if FORWARD_LIST_TAIL_POINTER
+    m_tail = node;
+#endif
+}
+
+
+// -----------------------------------------------------------
+// merge_chains - Merges the sorted chain `later` into the sorted
+// chain `chain`, stably. If `later` belongs entirely after (or
+// strictly before) `chain`, the two are concatenated without
+// visiting the nodes. If comp throws, `chain` still holds every
+// node of both chains, in an unspecified order.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename Compare>
+void forwardList<T, Allocator>::merge_chains(Chain& chain, Chain later, Compare& comp) {
+    if (!later.first) {
+        return;
+    }
+    if (!chain.first) {
+        chain = later;
+        return;
+    }
+
+    Node<T>* a = chain.first;
+    Node<T>* b = later.first;
+    Node<T>* head = nullptr;
+    Node<T>** link = &head;
+    try {
+        if (!comp(b->m_data, chain.last->m_data)) {
+            chain.last->m_next = b;
+            chain.last = later.last;
+            return;
+        }
+        if (comp(later.last->m_data, a->m_data)) {
+            later.last->m_next = a;
+            chain.first = b;
+            return;
+        }
+        while (a && b) {
+            if (comp(b->m_data, a->m_data)) {
+                *link = b;
+                link = &b->m_next;
+                b = b->m_next;
+            }
+            else {
+                *link = a;
+                link = &a->m_next;
+                a = a->m_next;
+            }
+        }
+    }
+    catch (...) {
+        // Both remainders are non-empty here: link them after the merged part
+        *link = a;
+        chain.last->m_next = b;
+        chain.first = head;
+        chain.last = later.last;
+        throw;
+    }
+    if (a) {
+        *link = a;
+    }
+    else {
+        *link = b;
+        chain.last = later.last;
+    }
+    chain.first = head;
+}
+
+
+// -----------------------------------------------------------
+// sort_chain - Sorts a detached chain with a bottom-up merge sort.
+// Nodes are taken one at a time and carried through a set of bins,
+// bin k holding a sorted run of 2^k nodes, like a binary counter;
+// the bins are merged at the end. Runs from higher bins hold earlier
+// nodes, which keeps the sort stable. Only chain.first is read;
+// chain.last is set to the new last node. If comp throws, the chain
+// still holds every node, in an unspecified order.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename Compare>
+void forwardList<T, Allocator>::sort_chain(Chain& chain, Compare& comp) {
+    Chain bins[64];
+    Chain carry;
+    Node<T>* rest = chain.first;
+
+    // Merges the carried run into bin (the earlier run) and carries the result
+    auto carryInto = [&carry, &comp](Chain& bin) {
+        Chain later = carry;
+        carry = Chain();
+        merge_chains(bin, later, comp);
+        carry = bin;
+        bin = Chain();
+    };
+
+    try {
+        while (rest) {
+            carry.first = rest;
+            carry.last = rest;
+            rest = rest->m_next;
+            carry.last->m_next = nullptr;
+
+            std::size_t k = 0;
+            for (; bins[k].first; ++k) {
+                carryInto(bins[k]);
+            }
+            bins[k] = carry;
+            carry = Chain();
+        }
+        for (Chain& bin : bins) {
+            if (bin.first) {
+                carryInto(bin);
+            }
+        }
+    }
+    catch (...) {
+        // Relink the carried run, the bins and the unsorted rest
+        chain = Chain();
+        auto attach = [&chain](Node<T>* node) {
+            if (!node) {
+                return;
+            }
+            if (chain.last) {
+                chain.last->m_next = node;
+            }
+            else {
+                chain.first = node;
+            }
+            for (chain.last = node; chain.last->m_next; chain.last = chain.last->m_next) { }
+        };
+        attach(carry.first);
+        for (const Chain& bin : bins) {
+            attach(bin.first);
+        }
+        attach(rest);
+        throw;
+    }
+    chain = carry;
+}
+
+
+// -----------------------------------------------------------
+// run_parallel - Calls task(i) for every i in [0, count): task 0 on
+// the calling thread and the others on threads of their own (or on
+// the calling thread if no thread can be started). Waits for all of
+// them, then rethrows the first exception a task threw, if any.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename Task>
+void forwardList<T, Allocator>::run_parallel(size_type count, Task& task) {
+    std::vector<std::exception_ptr> errors(count);
+    std::vector<std::thread> workers;
+    workers.reserve(count - 1);
+
+    auto guarded = [&task, &errors](size_type i) {
+        try {
+            task(i);
+        }
+        catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+    for (size_type i = 1; i < count; ++i) {
+        try {
+            workers.emplace_back(guarded, i);
+        }
+        catch (const std::system_error&) {
+            guarded(i);
+        }
+    }
+    guarded(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+
+// -----------------------------------------------------------
+// destroy_chain - Destroys every node of a detached, null-terminated
+// chain.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void forwardList<T, Allocator>::destroy_chain(Node<T>* node) {
+    while (node) {
+        Node<T>* next = node->m_next;
+        destroy_node(node);
+        node = next;
+    }
 }
@@ -4,11 +4,12 @@
 #include <iostream>
 #include <memory>
 #include <initializer_list>
+#include <type_traits>
 
 template <typename T>
 class Node;
 
-template <typename T>
+template <typename T, typename Allocator>
 class forwardList;
 
 template <typename T>
@@ -19,9 +20,14 @@ public:
     using difference_type = std::ptrdiff_t;
     using pointer = T*;
     using reference = T&;
+    using node_type = Node<typename std::remove_const<T>::type>;
 
     Iterator();
-    explicit Iterator(Node<T>*);
+    explicit Iterator(node_type*);
+
+    template <typename U, typename = typename std::enable_if<std::is_same<const U, T>::value && !std::is_same<U, T>::value>::type>
+    Iterator(const Iterator<U>&);
+
     reference operator*() const;
     pointer operator->() const;
     Iterator& operator++();
@@ -31,10 +37,11 @@ public:
     Iterator operator+(difference_type) const;
     Iterator& operator+=(difference_type);
 
-    friend class forwardList<T>;
+    template <typename, typename>
+    friend class forwardList;
     friend class Node<T>;
 public: 
-    Node<T>* data;
+    node_type* data;
 };
 
 #include "listIteratorImplementation.tpp"
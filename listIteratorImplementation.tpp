@@ -14,7 +14,19 @@ Iterator<T>::Iterator() : data(nullptr) { }
  * @param p A pointer to a Node<T> object which the iterator will point to.
  */
 template <typename T>
-Iterator<T>::Iterator(Node<T>* p) : data(p) { }
+Iterator<T>::Iterator(node_type* p) : data(p) { }
+
+/**
+ * @brief Converting constructor from a mutable iterator to a constant one.
+ * 
+ * Allows an Iterator<T> to be passed wherever an Iterator<const T> is expected,
+ * e.g. `list.insert_range_after(list.begin(), first, last)`.
+ * 
+ * @param other The mutable iterator pointing to the same node.
+ */
+template <typename T>
+template <typename U, typename>
+Iterator<T>::Iterator(const Iterator<U>& other) : data(other.data) { }
 
 /**
  * @brief Dereference operator to access the value of the current node the iterator is pointing to.
@@ -48,7 +48,14 @@ int main() {
     }
     std::cout << std::endl;
 
-    // 7. Create another list and merge
+    // 7. Sort the list, then merge another sorted list into it
+    list1.sort();
+    std::cout << "List after sort(): ";
+    for (auto it = list1.begin(); it != list1.end(); ++it) {
+        std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+
     forwardList<int> list2;
     list2.push_front(8);
     list2.push_front(5);
@@ -89,5 +96,14 @@ int main() {
     }
     std::cout << std::endl;
 
+    // 10. Append at the back and query the size
+    list1.push_back(60);
+    list1.emplace_back(70);
+    std::cout << "List1 after push_back(60), emplace_back(70): ";
+    for (auto it = list1.begin(); it != list1.end(); ++it) {
+        std::cout << *it << " ";
+    }
+    std::cout << "(size " << list1.size() << ")" << std::endl;
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,143 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// A slab/arena pool that hands out fixed-size blocks. Blocks are carved out
+// of large contiguous chunks, recycled through an intrusive free list, and
+// the chunks themselves are released all at once.
+class nodePool {
+public:
+    using size_type = std::size_t;
+
+    nodePool(size_type blockSize, size_type blockAlign, size_type blocksPerChunk);
+    ~nodePool();
+    nodePool(const nodePool&) = delete;
+    nodePool& operator=(const nodePool&) = delete;
+
+    void* allocate();
+    void deallocate(void*) noexcept;
+    void reserve(size_type);
+    void release() noexcept;
+    bool serves(size_type, size_type) const noexcept;
+    size_type chunk_count() const noexcept;
+
+private:
+    struct FreeBlock {
+        FreeBlock* m_next;
+    };
+
+    struct Chunk {
+        Chunk* m_next;
+        size_type m_count;
+    };
+
+    void add_chunk(size_type);
+    unsigned char* blocks_of(Chunk*) const noexcept;
+
+    Chunk* m_chunks;
+    FreeBlock* m_freeList;
+    unsigned char* m_bump;
+    unsigned char* m_bumpEnd;
+    size_type m_blockSize;
+    size_type m_blockAlign;
+    size_type m_requestedSize;
+    size_type m_header;
+    size_type m_blocksPerChunk;
+    size_type m_chunkCount;
+};
+
+// The set of pools shared by a family of poolAllocators, one pool per
+// block size/alignment. Rebinding an allocator keeps the same resource.
+// Not synchronized: see poolAllocator.
+class poolResource {
+public:
+    using size_type = std::size_t;
+
+    explicit poolResource(size_type blocksPerChunk);
+
+    nodePool& pool_for(size_type, size_type);
+    nodePool* find(size_type, size_type) const noexcept;
+    void release() noexcept;
+
+private:
+    std::map<std::pair<size_type, size_type>, std::unique_ptr<nodePool>> m_pools;
+    size_type m_blocksPerChunk;
+};
+
+// std::allocator_traits-compatible allocator backed by a shared poolResource.
+// Copies and rebound copies (e.g. from T to Node<T>) draw from the same
+// resource, so they compare equal and may free each other's blocks.
+//
+// The resource is not synchronized. Every container built from the same
+// allocator object (or a copy of it) must be used from one thread at a
+// time; a copied container gets a resource of its own and is independent.
+template <typename T, std::size_t BlocksPerChunk = 256>
+class poolAllocator {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template <typename U>
+    struct rebind {
+        using other = poolAllocator<U, BlocksPerChunk>;
+    };
+
+    poolAllocator();
+    poolAllocator(const poolAllocator&) noexcept = default;
+    poolAllocator& operator=(const poolAllocator&) noexcept = default;
+
+    template <typename U>
+    poolAllocator(const poolAllocator<U, BlocksPerChunk>&) noexcept;
+
+    T* allocate(size_type);
+    void deallocate(T*, size_type) noexcept;
+    void reserve(size_type);
+    bool release() noexcept;
+    poolAllocator select_on_container_copy_construction() const;
+
+    template <typename U>
+    bool operator==(const poolAllocator<U, BlocksPerChunk>&) const noexcept;
+    template <typename U>
+    bool operator!=(const poolAllocator<U, BlocksPerChunk>&) const noexcept;
+
+private:
+    template <typename, std::size_t>
+    friend class poolAllocator;
+
+    nodePool& pool();
+
+    std::shared_ptr<poolResource> m_resource;
+    nodePool* m_pool;
+};
+
+// Detects allocators that can drop all of their memory at once through a
+// release() member, letting containers skip the per-node deallocation walk.
+template <typename Alloc, typename = void>
+struct hasBulkRelease : std::false_type { };
+
+template <typename Alloc>
+struct hasBulkRelease<Alloc, std::void_t<decltype(std::declval<Alloc&>().release())>> : std::true_type { };
+
+// Detects allocators that can set aside room for a known number of single
+// allocations up front through a reserve() member, so that bulk insertions
+// obtain their memory in one batch.
+template <typename Alloc, typename = void>
+struct hasReserve : std::false_type { };
+
+template <typename Alloc>
+struct hasReserve<Alloc, std::void_t<decltype(std::declval<Alloc&>().reserve(std::size_t()))>> : std::true_type { };
+
+#include "nodePoolImplementation.tpp"
+
+#endif
\ No newline at end of file
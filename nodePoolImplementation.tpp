@@ -0,0 +1,301 @@
+#include "nodePoolHeader.hpp"
+
+// -----------------------------------------------------------
+// nodePool Constructor - Creates an empty pool for blocks of the
+// given size and alignment. No memory is reserved until the first
+// block is requested; every chunk allocated afterwards holds
+// blocksPerChunk blocks.
+// -----------------------------------------------------------
+inline nodePool::nodePool(size_type blockSize, size_type blockAlign, size_type blocksPerChunk)
+    : m_chunks(nullptr), m_freeList(nullptr), m_bump(nullptr), m_bumpEnd(nullptr),
+      m_blockSize(0), m_blockAlign(0), m_requestedSize(blockSize), m_header(0),
+      m_blocksPerChunk(blocksPerChunk ? blocksPerChunk : 1), m_chunkCount(0) {
+    m_blockAlign = blockAlign > alignof(FreeBlock) ? blockAlign : alignof(FreeBlock);
+    if (m_blockAlign < alignof(Chunk)) {
+        m_blockAlign = alignof(Chunk);
+    }
+    size_type size = blockSize > sizeof(FreeBlock) ? blockSize : sizeof(FreeBlock);
+    m_blockSize = (size + m_blockAlign - 1) / m_blockAlign * m_blockAlign;
+    m_header = (sizeof(Chunk) + m_blockAlign - 1) / m_blockAlign * m_blockAlign;
+}
+
+
+// -----------------------------------------------------------
+// nodePool Destructor - Returns every chunk to the system in
+// O(chunks), regardless of how many blocks are still handed out.
+// -----------------------------------------------------------
+inline nodePool::~nodePool() {
+    release();
+}
+
+
+// -----------------------------------------------------------
+// allocate - Hands out one uninitialized block. Recycled blocks
+// from the free list are preferred; otherwise the next block of
+// the newest chunk is taken, and a new chunk is added once it
+// runs out.
+// -----------------------------------------------------------
+inline void* nodePool::allocate() {
+    if (m_freeList) {
+        FreeBlock* block = m_freeList;
+        m_freeList = block->m_next;
+        return block;
+    }
+    if (m_bump == m_bumpEnd) {
+        add_chunk(m_blocksPerChunk);
+    }
+    void* block = m_bump;
+    m_bump += m_blockSize;
+    return block;
+}
+
+
+// -----------------------------------------------------------
+// deallocate - Pushes a block back onto the intrusive free list
+// so that the next allocate() can reuse it. The chunk memory
+// itself stays owned by the pool.
+// -----------------------------------------------------------
+inline void nodePool::deallocate(void* p) noexcept {
+    if (!p) {
+        return;
+    }
+    FreeBlock* block = ::new (p) FreeBlock{m_freeList};
+    m_freeList = block;
+}
+
+
+// -----------------------------------------------------------
+// reserve - Makes sure the next count blocks can be handed out
+// without allocating more than once: if the current bump region is
+// too small, a single chunk with room for at least count blocks is
+// added right away.
+// -----------------------------------------------------------
+inline void nodePool::reserve(size_type count) {
+    size_type available = static_cast<size_type>(m_bumpEnd - m_bump) / m_blockSize;
+    if (count > available) {
+        add_chunk(count > m_blocksPerChunk ? count : m_blocksPerChunk);
+    }
+}
+
+
+// -----------------------------------------------------------
+// release - Frees all chunks at once and resets the pool to its
+// empty state. Any block handed out before becomes invalid, so
+// callers must have destroyed the objects living in them.
+// -----------------------------------------------------------
+inline void nodePool::release() noexcept {
+    while (m_chunks) {
+        Chunk* next = m_chunks->m_next;
+        ::operator delete(static_cast<void*>(m_chunks), std::align_val_t(m_blockAlign));
+        m_chunks = next;
+    }
+    m_freeList = nullptr;
+    m_bump = nullptr;
+    m_bumpEnd = nullptr;
+    m_chunkCount = 0;
+}
+
+
+// -----------------------------------------------------------
+// serves - Checks whether this pool was created for blocks of the
+// given size and alignment.
+// -----------------------------------------------------------
+inline bool nodePool::serves(size_type blockSize, size_type blockAlign) const noexcept {
+    return m_requestedSize == blockSize && m_blockAlign >= blockAlign;
+}
+
+
+// -----------------------------------------------------------
+// chunk_count - Returns how many chunks the pool currently owns.
+// -----------------------------------------------------------
+inline nodePool::size_type nodePool::chunk_count() const noexcept {
+    return m_chunkCount;
+}
+
+
+// -----------------------------------------------------------
+// add_chunk - Allocates one contiguous chunk with room for count
+// blocks and makes it the bump region. Blocks left over in the
+// previous bump region are moved to the free list first.
+// -----------------------------------------------------------
+inline void nodePool::add_chunk(size_type count) {
+    void* raw = ::operator new(m_header + count * m_blockSize, std::align_val_t(m_blockAlign));
+    Chunk* chunk = ::new (raw) Chunk{m_chunks, count};
+    m_chunks = chunk;
+    ++m_chunkCount;
+
+    while (m_bump != m_bumpEnd) {
+        deallocate(m_bump);
+        m_bump += m_blockSize;
+    }
+    m_bump = blocks_of(chunk);
+    m_bumpEnd = m_bump + count * m_blockSize;
+}
+
+
+// -----------------------------------------------------------
+// blocks_of - Returns the first block of a chunk, located right
+// after the (padded) chunk header.
+// -----------------------------------------------------------
+inline unsigned char* nodePool::blocks_of(Chunk* chunk) const noexcept {
+    return reinterpret_cast<unsigned char*>(chunk) + m_header;
+}
+
+
+// -----------------------------------------------------------
+// poolResource Constructor - Creates an empty set of pools whose
+// chunks will hold blocksPerChunk blocks each.
+// -----------------------------------------------------------
+inline poolResource::poolResource(size_type blocksPerChunk) : m_pools(), m_blocksPerChunk(blocksPerChunk) { }
+
+
+// -----------------------------------------------------------
+// pool_for - Returns the pool serving blocks of the given size and
+// alignment, creating it on first use.
+// -----------------------------------------------------------
+inline nodePool& poolResource::pool_for(size_type blockSize, size_type blockAlign) {
+    if (nodePool* pool = find(blockSize, blockAlign)) {
+        return *pool;
+    }
+    auto pool = std::make_unique<nodePool>(blockSize, blockAlign, m_blocksPerChunk);
+    return *m_pools.emplace(std::make_pair(blockSize, blockAlign), std::move(pool)).first->second;
+}
+
+
+// -----------------------------------------------------------
+// find - Returns the pool serving blocks of the given size and
+// alignment, or nullptr if there is none yet. Never allocates.
+// -----------------------------------------------------------
+inline nodePool* poolResource::find(size_type blockSize, size_type blockAlign) const noexcept {
+    auto it = m_pools.find(std::make_pair(blockSize, blockAlign));
+    return it == m_pools.end() ? nullptr : it->second.get();
+}
+
+
+// -----------------------------------------------------------
+// release - Releases the chunks of every pool in the resource.
+// -----------------------------------------------------------
+inline void poolResource::release() noexcept {
+    for (auto& entry : m_pools) {
+        entry.second->release();
+    }
+}
+
+
+// -----------------------------------------------------------
+// poolAllocator Constructor (Default) - Creates an allocator
+// owning a new, empty resource. The pool for T's block size is
+// looked up on first use, since containers mostly allocate
+// through a rebound copy and never touch the pool for T itself.
+// -----------------------------------------------------------
+template <typename T, std::size_t BlocksPerChunk>
+poolAllocator<T, BlocksPerChunk>::poolAllocator()
+    : m_resource(std::make_shared<poolResource>(BlocksPerChunk)), m_pool(nullptr) { }
+
+
+// -----------------------------------------------------------
+// poolAllocator Constructor (Rebind) - Shares the resource of the
+// source allocator. Its pool is looked up on first use as well.
+// -----------------------------------------------------------
+template <typename T, std::size_t BlocksPerChunk>
+template <typename U>
+poolAllocator<T, BlocksPerChunk>::poolAllocator(const poolAllocator<U, BlocksPerChunk>& other) noexcept
+    : m_resource(other.m_resource), m_pool(nullptr) { }
+
+
+// -----------------------------------------------------------
+// allocate - Single objects come from the pool; arrays are rare
+// for node-based containers and go straight to operator new.
+// -----------------------------------------------------------
+template <typename T, std::size_t BlocksPerChunk>
+T* poolAllocator<T, BlocksPerChunk>::allocate(size_type n) {
+    if (n == 1) {
+        return static_cast<T*>(pool().allocate());
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+}
+
+
+// -----------------------------------------------------------
+// deallocate - Returns memory obtained from allocate() to the
+// place it came from. The block came from an equal allocator, so
+// its pool already exists and is found without allocating.
+// -----------------------------------------------------------
+template <typename T, std::size_t BlocksPerChunk>
+void poolAllocator<T, BlocksPerChunk>::deallocate(T* p, size_type n) noexcept {
+    if (n == 1) {
+        if (!m_pool) {
+            m_pool = m_resource->find(sizeof(T), alignof(T));
+        }
+        m_pool->deallocate(p);
+        return;
+    }
+    ::operator delete(static_cast<void*>(p), std::align_val_t(alignof(T)));
+}
+
+
+// -----------------------------------------------------------
+// reserve - Sets aside room for count single-object allocations,
+// so that building a list of known length takes one chunk.
+// -----------------------------------------------------------
+template <typename T, std::size_t BlocksPerChunk>
+void poolAllocator<T, BlocksPerChunk>::reserve(size_type count) {
+    pool().reserve(count);
+}
+
+
+// -----------------------------------------------------------
+// release - Drops every chunk of the resource in one go, but only
+// if this allocator is the resource's sole owner; otherwise blocks
+// that belong to someone else could be freed. Returns whether the
+// release happened.
+// -----------------------------------------------------------
+template <typename T, std::size_t BlocksPerChunk>
+bool poolAllocator<T, BlocksPerChunk>::release() noexcept {
+    if (m_resource.use_count() != 1) {
+        return false;
+    }
+    m_resource->release();
+    return true;
+}
+
+
+// -----------------------------------------------------------
+// select_on_container_copy_construction - A copied container gets
+// a fresh resource, so that it can later release its chunks without
+// affecting the original.
+// -----------------------------------------------------------
+template <typename T, std::size_t BlocksPerChunk>
+poolAllocator<T, BlocksPerChunk> poolAllocator<T, BlocksPerChunk>::select_on_container_copy_construction() const {
+    return poolAllocator();
+}
+
+
+// -----------------------------------------------------------
+// Equality Operators - Two allocators are equal when they share
+// a resource, i.e. memory from one can be freed through the other.
+// -----------------------------------------------------------
+template <typename T, std::size_t BlocksPerChunk>
+template <typename U>
+bool poolAllocator<T, BlocksPerChunk>::operator==(const poolAllocator<U, BlocksPerChunk>& other) const noexcept {
+    return m_resource == other.m_resource;
+}
+
+template <typename T, std::size_t BlocksPerChunk>
+template <typename U>
+bool poolAllocator<T, BlocksPerChunk>::operator!=(const poolAllocator<U, BlocksPerChunk>& other) const noexcept {
+    return m_resource != other.m_resource;
+}
+
+// -----------------------------------------------------------
+// pool - Returns the pool serving T's block size, looking it up in
+// the resource (and creating it there) on first use and caching it
+// on this allocator afterwards.
+// -----------------------------------------------------------
+template <typename T, std::size_t BlocksPerChunk>
+nodePool& poolAllocator<T, BlocksPerChunk>::pool() {
+    if (!m_pool) {
+        m_pool = &m_resource->pool_for(sizeof(T), alignof(T));
+    }
+    return *m_pool;
+}
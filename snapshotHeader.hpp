@@ -0,0 +1,116 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "listHeader.hpp"
+#include "nodePoolHeader.hpp"
+#include "snapshotIteratorHeader.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Binary snapshots of a forwardList of trivially copyable elements.
+//
+// A snapshot file starts with a SnapshotHeader and is followed by one
+// SnapshotRecord per element, in list order. Each record links to the next
+// one by its byte offset from the start of the file (0 ends the list), so
+// a snapshot is relocatable: it can be mapped at any address and walked
+// in place. Snapshots are native-endian and tied to the element's size
+// and alignment; opening one checks both. Iteration checks that every link
+// stays on a record boundary inside the file and that the list ends after
+// exactly as many records as the header counts, and throws
+// std::runtime_error otherwise. Element values are not checked.
+
+// File header, 64 bytes.
+struct SnapshotHeader {
+    char m_magic[8];
+    std::uint32_t m_version;
+    std::uint32_t m_byteOrder;
+    std::uint64_t m_elementSize;
+    std::uint64_t m_elementAlign;
+    std::uint64_t m_recordSize;
+    std::uint64_t m_count;
+    std::uint64_t m_head;
+    std::uint64_t m_reserved;
+
+    static constexpr char s_magic[8] = "FWDLIST";
+    static constexpr std::uint32_t s_version = 1;
+    static constexpr std::uint32_t s_byteOrder = 0x01020304;
+};
+
+// One element and the file offset of the next record.
+template <typename T>
+struct SnapshotRecord {
+    T m_value;
+    std::uint64_t m_next;
+};
+
+// Offset of the first record: the header size rounded up to the record
+// alignment.
+template <typename T>
+constexpr std::uint64_t snapshotFirstRecord();
+
+// Writes the elements of list to a snapshot file at path, replacing it
+// only once the new snapshot is complete.
+template <typename T, typename Allocator>
+void saveSnapshot(const forwardList<T, Allocator>&, const std::string&);
+
+// Replaces the contents of list with the elements of the snapshot at path.
+template <typename T, typename Allocator>
+void loadSnapshot(forwardList<T, Allocator>&, const std::string&);
+
+// Read-only view of a snapshot file. Opening it maps the file and reads
+// only the header, so it takes the same time for any number of elements;
+// the records are paged in as they are iterated. The view owns the
+// mapping, and iterators into it are valid as long as the view lives.
+// POSIX only (mmap).
+template <typename T>
+class snapshotView {
+    static_assert(std::is_trivially_copyable<T>::value, "Snapshots hold trivially copyable elements only");
+    static_assert(alignof(SnapshotRecord<T>) <= 4096, "Snapshot records must not need more than page alignment");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_reference = const value_type&;
+    using iterator = SnapshotIterator<T>;
+    using const_iterator = SnapshotIterator<T>;
+
+public:
+    explicit snapshotView(const std::string&);
+    ~snapshotView();
+    snapshotView(const snapshotView&) = delete;
+    snapshotView& operator=(const snapshotView&) = delete;
+    snapshotView(snapshotView&&) noexcept;
+    snapshotView& operator=(snapshotView&&) noexcept;
+
+    template <typename Allocator = poolAllocator<T>>
+    forwardList<T, Allocator> materialize(const Allocator& = Allocator()) const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    bool empty() const;
+    size_type size() const noexcept;
+
+private:
+    void unmap() noexcept;
+
+    const unsigned char* m_base;
+    std::size_t m_length;
+    size_type m_size;
+    std::uint64_t m_head;
+};
+
+#include "snapshotImplementation.tpp"
+
+#endif
@@ -0,0 +1,264 @@
+#include "snapshotHeader.hpp"
+
+// -----------------------------------------------------------
+// snapshotFirstRecord - Returns the offset of the first record.
+// Mappings are page aligned, so aligning records within the file
+// aligns them in memory.
+// -----------------------------------------------------------
+template <typename T>
+constexpr std::uint64_t snapshotFirstRecord() {
+    constexpr std::uint64_t align = alignof(SnapshotRecord<T>);
+    return (sizeof(SnapshotHeader) + align - 1) / align * align;
+}
+
+
+// -----------------------------------------------------------
+// saveSnapshot - Writes the header followed by one record per
+// element, in list order, each linking to the record right after
+// it. Records are staged in a buffer and written in batches. Each
+// record is zeroed and its fields are copied in one by one, so the
+// padding between and after them is written as zeros. Padding
+// inside T itself is copied as it is in memory. The snapshot is
+// written to path + ".tmp" and renamed over path once complete, so
+// a failed or interrupted save leaves any previous snapshot intact.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void saveSnapshot(const forwardList<T, Allocator>& list, const std::string& path) {
+    static_assert(std::is_trivially_copyable<T>::value, "Snapshots hold trivially copyable elements only");
+    using record_type = SnapshotRecord<T>;
+    struct slot_type {
+        alignas(record_type) unsigned char m_bytes[sizeof(record_type)];
+    };
+    constexpr std::size_t batch = 4096;
+    const std::uint64_t first = snapshotFirstRecord<T>();
+    const std::uint64_t count = list.size();
+
+    SnapshotHeader header{};
+    std::memcpy(header.m_magic, SnapshotHeader::s_magic, sizeof(header.m_magic));
+    header.m_version = SnapshotHeader::s_version;
+    header.m_byteOrder = SnapshotHeader::s_byteOrder;
+    header.m_elementSize = sizeof(T);
+    header.m_elementAlign = alignof(T);
+    header.m_recordSize = sizeof(record_type);
+    header.m_count = count;
+    header.m_head = count ? first : 0;
+
+    std::vector<char> prologue(first, 0);
+    std::memcpy(prologue.data(), &header, sizeof(header));
+    std::vector<slot_type> buffer(count < batch ? count : batch);
+
+    const std::string staging = path + ".tmp";
+    std::ofstream file(staging, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Cannot open snapshot file for writing: " + staging);
+    }
+    file.write(prologue.data(), static_cast<std::streamsize>(prologue.size()));
+
+    std::size_t filled = 0;
+    std::uint64_t offset = first;
+    std::uint64_t written = 0;
+    for (auto it = list.cbegin(); it != list.cend() && file; ++it) {
+        ++written;
+        offset += sizeof(record_type);
+        const std::uint64_t next = written == count ? 0 : offset;
+        unsigned char* record = buffer[filled].m_bytes;
+        std::memset(record, 0, sizeof(record_type));
+        std::memcpy(record + offsetof(record_type, m_value), &*it, sizeof(T));
+        std::memcpy(record + offsetof(record_type, m_next), &next, sizeof(next));
+        if (++filled == buffer.size()) {
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(filled * sizeof(record_type)));
+            filled = 0;
+        }
+    }
+    file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(filled * sizeof(record_type)));
+
+    file.flush();
+    file.close();
+    if (!file) {
+        std::remove(staging.c_str());
+        throw std::runtime_error("Cannot write snapshot file: " + staging);
+    }
+    if (std::rename(staging.c_str(), path.c_str()) != 0) {
+        std::remove(staging.c_str());
+        throw std::runtime_error("Cannot replace snapshot file: " + path);
+    }
+}
+
+
+// -----------------------------------------------------------
+// loadSnapshot - Maps the snapshot and assigns its elements to the
+// list. With poolAllocator, the nodes are reserved in one batch.
+// -----------------------------------------------------------
+template <typename T, typename Allocator>
+void loadSnapshot(forwardList<T, Allocator>& list, const std::string& path) {
+    snapshotView<T> view(path);
+    list.assign(view.cbegin(), view.cend(), view.size());
+}
+
+
+// -----------------------------------------------------------
+// snapshotView Constructor - Maps the file read-only and checks its
+// header against T. Throws std::runtime_error if the file cannot be
+// mapped, is not a snapshot, or was written for another element
+// type.
+// -----------------------------------------------------------
+template <typename T>
+snapshotView<T>::snapshotView(const std::string& path) : m_base(nullptr), m_length(0), m_size(0), m_head(0) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open snapshot file: " + path);
+    }
+    struct stat status;
+    if (::fstat(fd, &status) != 0 || static_cast<std::uint64_t>(status.st_size) < sizeof(SnapshotHeader)) {
+        ::close(fd);
+        throw std::runtime_error("Not a forwardList snapshot: " + path);
+    }
+    m_length = static_cast<std::size_t>(status.st_size);
+    void* mapping = ::mmap(nullptr, m_length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("Cannot map snapshot file: " + path);
+    }
+    m_base = static_cast<const unsigned char*>(mapping);
+
+    SnapshotHeader header;
+    std::memcpy(&header, m_base, sizeof(header));
+    const std::uint64_t first = snapshotFirstRecord<T>();
+    const std::uint64_t recordSize = sizeof(SnapshotRecord<T>);
+    const char* error = nullptr;
+    if (std::memcmp(header.m_magic, SnapshotHeader::s_magic, sizeof(header.m_magic)) != 0 || header.m_version != SnapshotHeader::s_version) {
+        error = "Not a forwardList snapshot: ";
+    }
+    else if (header.m_byteOrder != SnapshotHeader::s_byteOrder || header.m_elementSize != sizeof(T) ||
+             header.m_elementAlign != alignof(T) || header.m_recordSize != recordSize) {
+        error = "Snapshot was written for another element type: ";
+    }
+    else if (m_length < first || header.m_count > (m_length - first) / recordSize || (header.m_count == 0) != (header.m_head == 0) ||
+             (header.m_head && (header.m_head < first || header.m_head > m_length - recordSize || (header.m_head - first) % recordSize != 0))) {
+        error = "Corrupt snapshot file: ";
+    }
+    if (error) {
+        unmap();
+        throw std::runtime_error(error + path);
+    }
+    m_size = static_cast<size_type>(header.m_count);
+    m_head = header.m_head;
+}
+
+
+// -----------------------------------------------------------
+// Destructor - Unmaps the file.
+// -----------------------------------------------------------
+template <typename T>
+snapshotView<T>::~snapshotView() {
+    unmap();
+}
+
+
+// -----------------------------------------------------------
+// snapshotView Constructor (Move) - Takes over the mapping of the
+// other view, leaving it empty.
+// -----------------------------------------------------------
+template <typename T>
+snapshotView<T>::snapshotView(snapshotView&& other) noexcept
+    : m_base(other.m_base), m_length(other.m_length), m_size(other.m_size), m_head(other.m_head) {
+    other.m_base = nullptr;
+    other.m_length = 0;
+    other.m_size = 0;
+    other.m_head = 0;
+}
+
+
+// -----------------------------------------------------------
+// Move Assignment Operator - Unmaps this view's file and takes over
+// the mapping of the other view.
+// -----------------------------------------------------------
+template <typename T>
+snapshotView<T>& snapshotView<T>::operator=(snapshotView&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        m_base = other.m_base;
+        m_length = other.m_length;
+        m_size = other.m_size;
+        m_head = other.m_head;
+        other.m_base = nullptr;
+        other.m_length = 0;
+        other.m_size = 0;
+        other.m_head = 0;
+    }
+    return *this;
+}
+
+
+// -----------------------------------------------------------
+// materialize - Copies the elements into a new, mutable forwardList.
+// With the default poolAllocator all nodes come from one slab
+// reserved up front, so this makes a single bulk allocation.
+// -----------------------------------------------------------
+template <typename T>
+template <typename Allocator>
+forwardList<T, Allocator> snapshotView<T>::materialize(const Allocator& alloc) const {
+    forwardList<T, Allocator> list(alloc);
+    list.assign(cbegin(), cend(), m_size);
+    return list;
+}
+
+
+// -----------------------------------------------------------
+// begin / end - Iterators to the first element and past the last
+// element of the snapshot.
+// -----------------------------------------------------------
+template <typename T>
+typename snapshotView<T>::const_iterator snapshotView<T>::begin() const {
+    return cbegin();
+}
+
+template <typename T>
+typename snapshotView<T>::const_iterator snapshotView<T>::end() const {
+    return cend();
+}
+
+
+// -----------------------------------------------------------
+// cbegin / cend - Same as begin / end; a view is always constant.
+// -----------------------------------------------------------
+template <typename T>
+typename snapshotView<T>::const_iterator snapshotView<T>::cbegin() const {
+    return const_iterator(m_base, m_head ? reinterpret_cast<const SnapshotRecord<T>*>(m_base + m_head) : nullptr, m_size, m_length);
+}
+
+template <typename T>
+typename snapshotView<T>::const_iterator snapshotView<T>::cend() const {
+    return const_iterator(m_base, nullptr, 0, m_length);
+}
+
+
+// -----------------------------------------------------------
+// empty - Checks if the snapshot holds no elements.
+// -----------------------------------------------------------
+template <typename T>
+bool snapshotView<T>::empty() const {
+    return m_size == 0;
+}
+
+
+// -----------------------------------------------------------
+// size - Returns the number of elements, read from the header.
+// -----------------------------------------------------------
+template <typename T>
+typename snapshotView<T>::size_type snapshotView<T>::size() const noexcept {
+    return m_size;
+}
+
+
+// -----------------------------------------------------------
+// unmap - Releases the mapping, if any.
+// -----------------------------------------------------------
+template <typename T>
+void snapshotView<T>::unmap() noexcept {
+    if (m_base) {
+        ::munmap(const_cast<unsigned char*>(m_base), m_length);
+        m_base = nullptr;
+        m_length = 0;
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef SNAPSHOT_ITERATOR_H
+#define SNAPSHOT_ITERATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+template <typename T>
+struct SnapshotRecord;
+
+template <typename T>
+constexpr std::uint64_t snapshotFirstRecord();
+
+template <typename T>
+class snapshotView;
+
+// Constant forward iterator over a snapshotView. It points straight into
+// the mapped file and follows each record's link, a byte offset from the
+// start of the file, so iterating copies nothing. It also counts down the
+// records the header announced and checks every link against the mapping,
+// so a corrupt file throws std::runtime_error instead of being read out
+// of bounds or walked in a cycle forever.
+template <typename T>
+class SnapshotIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+    using record_type = SnapshotRecord<T>;
+
+    SnapshotIterator();
+    SnapshotIterator(const unsigned char*, const record_type*, std::uint64_t, std::uint64_t);
+
+    reference operator*() const;
+    pointer operator->() const;
+    SnapshotIterator& operator++();
+    SnapshotIterator operator++(int);
+    bool operator==(const SnapshotIterator&) const;
+    bool operator!=(const SnapshotIterator&) const;
+
+public:
+    const unsigned char* base;
+    const record_type* record;
+    std::uint64_t remaining;
+    std::uint64_t length;
+};
+
+#include "snapshotIteratorImplementation.tpp"
+
+#endif
@@ -0,0 +1,107 @@
+#include "snapshotIteratorHeader.hpp"
+
+/**
+ * @brief Default constructor for SnapshotIterator class.
+ *
+ * Initializes the iterator to the end position.
+ */
+template <typename T>
+SnapshotIterator<T>::SnapshotIterator() : base(nullptr), record(nullptr), remaining(0), length(0) { }
+
+/**
+ * @brief Constructor for SnapshotIterator class that points at one record.
+ *
+ * @param b The start of the mapped snapshot, which links are relative to.
+ * @param r The record holding the element, or nullptr for the end position.
+ * @param n The number of records left, including r.
+ * @param l The length of the mapping, which every link must stay inside.
+ */
+template <typename T>
+SnapshotIterator<T>::SnapshotIterator(const unsigned char* b, const record_type* r, std::uint64_t n, std::uint64_t l)
+    : base(b), record(r), remaining(n), length(l) { }
+
+/**
+ * @brief Dereference operator to access the element the iterator is pointing to.
+ *
+ * @return reference A constant reference to the element inside the mapped file.
+ */
+template <typename T>
+typename SnapshotIterator<T>::reference SnapshotIterator<T>::operator*() const {
+    return record->m_value;
+}
+
+/**
+ * @brief Arrow operator to access members of the element.
+ *
+ * @return pointer A constant pointer to the element inside the mapped file.
+ */
+template <typename T>
+typename SnapshotIterator<T>::pointer SnapshotIterator<T>::operator->() const {
+    return &record->m_value;
+}
+
+/**
+ * @brief Pre-increment operator to move the iterator to the next element.
+ *
+ * A link of 0 marks the last record, since offset 0 holds the file header.
+ * The last record announced by the header must carry that link and no
+ * other may; any other link must name a whole record inside the mapping.
+ *
+ * @return SnapshotIterator& A reference to the current iterator, after advancing.
+ * @throws std::runtime_error If the link breaks one of these rules.
+ */
+template <typename T>
+SnapshotIterator<T>& SnapshotIterator<T>::operator++() {
+    if (record) {
+        const std::uint64_t next = record->m_next;
+        const std::uint64_t first = snapshotFirstRecord<T>();
+        if (--remaining == 0 || next == 0) {
+            if (remaining != 0 || next != 0) {
+                throw std::runtime_error("Corrupt snapshot file: the record count does not match the links");
+            }
+            record = nullptr;
+        }
+        else if (next < first || next > length - sizeof(record_type) || (next - first) % sizeof(record_type) != 0) {
+            throw std::runtime_error("Corrupt snapshot file: a link points outside the records");
+        }
+        else {
+            record = reinterpret_cast<const record_type*>(base + next);
+        }
+    }
+    return *this;
+}
+
+/**
+ * @brief Post-increment operator to move the iterator to the next element.
+ *
+ * @param int Placeholder for the post-increment syntax.
+ * @return SnapshotIterator A copy of the iterator before it was incremented.
+ */
+template <typename T>
+SnapshotIterator<T> SnapshotIterator<T>::operator++(int) {
+    SnapshotIterator tmp = *this;
+    ++(*this);
+    return tmp;
+}
+
+/**
+ * @brief Equality operator to compare two iterators.
+ *
+ * @param other The iterator to compare with.
+ * @return bool True if both iterators point to the same record, false otherwise.
+ */
+template <typename T>
+bool SnapshotIterator<T>::operator==(const SnapshotIterator& other) const {
+    return record == other.record;
+}
+
+/**
+ * @brief Inequality operator to compare two iterators.
+ *
+ * @param other The iterator to compare with.
+ * @return bool True if the iterators point to different records, false otherwise.
+ */
+template <typename T>
+bool SnapshotIterator<T>::operator!=(const SnapshotIterator& other) const {
+    return record != other.record;
+}
@@ -0,0 +1,173 @@
+#include "../chunkedListHeader.hpp"
+#include <gtest/gtest.h>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename List>
+std::vector<typename List::value_type> contents(List& list) {
+    std::vector<typename List::value_type> values;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        values.push_back(*it);
+    }
+    return values;
+}
+
+// Can be copied but not moved; counts its copies
+struct pinned {
+    static int s_copies;
+    int value;
+
+    explicit pinned(int v) : value(v) { }
+    pinned(const pinned& other) noexcept : value(other.value) { ++s_copies; }
+    pinned(pinned&&) = delete;
+    pinned& operator=(const pinned& other) {
+        value = other.value;
+        ++s_copies;
+        return *this;
+    }
+    pinned& operator=(pinned&&) = delete;
+};
+
+int pinned::s_copies = 0;
+
+// Throws from its constructor when asked to
+struct fragile {
+    int value;
+
+    fragile(int v, bool fail) : value(v) {
+        if (fail) {
+            throw std::runtime_error("fragile");
+        }
+    }
+};
+
+template <typename List>
+std::vector<int> values(List& list) {
+    std::vector<int> result;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        result.push_back(it->value);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST(ChunkedForwardList, PushFrontFillsChunks) {
+    chunkedForwardList<int, 4> list;
+    for (int i = 0; i < 10; ++i) {
+        list.push_front(i);
+    }
+    EXPECT_EQ(list.size(), 10u);
+    EXPECT_EQ(contents(list), (std::vector<int>{9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+    EXPECT_LE(list.chunk_count(), 5u);
+}
+
+TEST(ChunkedForwardList, InsertAndEraseAfterMatchStdList) {
+    std::mt19937 random(42);
+    chunkedForwardList<int, 8> list;
+    std::list<int> reference;
+    for (int step = 0; step < 5000; ++step) {
+        if (reference.empty() || random() % 3 != 0) {
+            std::size_t position = reference.empty() ? 0 : random() % reference.size();
+            int value = static_cast<int>(random() % 1000);
+            if (reference.empty()) {
+                list.push_front(value);
+                reference.push_front(value);
+                continue;
+            }
+            auto it = list.cbegin();
+            auto referenceIt = reference.begin();
+            for (std::size_t i = 0; i < position; ++i) {
+                ++it;
+                ++referenceIt;
+            }
+            list.insert_after(it, value);
+            reference.insert(std::next(referenceIt), value);
+        }
+        else if (reference.size() > 1) {
+            std::size_t position = random() % (reference.size() - 1);
+            auto it = list.cbegin();
+            auto referenceIt = reference.begin();
+            for (std::size_t i = 0; i < position; ++i) {
+                ++it;
+                ++referenceIt;
+            }
+            list.erase_after(it);
+            reference.erase(std::next(referenceIt));
+        }
+    }
+    EXPECT_EQ(list.size(), reference.size());
+    EXPECT_EQ(contents(list), std::vector<int>(reference.begin(), reference.end()));
+}
+
+TEST(ChunkedForwardList, InsertRangeAfter) {
+    chunkedForwardList<std::string, 4> list;
+    list.push_front("a");
+    std::vector<std::string> values{"b", "c", "d", "e", "f", "g"};
+    list.insert_range_after(list.cbegin(), values.begin(), values.end());
+    EXPECT_EQ(contents(list), (std::vector<std::string>{"a", "b", "c", "d", "e", "f", "g"}));
+}
+
+TEST(ChunkedForwardList, CopyMoveAndClear) {
+    chunkedForwardList<int, 4> list(9, 5);
+    chunkedForwardList<int, 4> copy(list);
+    EXPECT_EQ(contents(copy), std::vector<int>(9, 5));
+
+    chunkedForwardList<int, 4> moved(std::move(list));
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(moved.size(), 9u);
+
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(moved.chunk_count(), 0u);
+}
+
+TEST(ChunkedForwardList, EraseAfterEndThrows) {
+    chunkedForwardList<int> list;
+    list.push_front(1);
+    EXPECT_THROW(list.erase_after(list.cend()), std::invalid_argument);
+}
+
+TEST(ChunkedForwardList, EmplaceConstructsInPlace) {
+    chunkedForwardList<pinned, 4> list;
+    pinned::s_copies = 0;
+    auto it = list.emplace_after(list.cend(), 1);
+    it = list.emplace_after(it, 2);
+    list.emplace_after(it, 3);
+    EXPECT_EQ(pinned::s_copies, 0);
+
+    for (int i = 4; i <= 10; ++i) {
+        list.emplace_front(i);
+    }
+    list.emplace_after(list.cbegin(), 0);
+    EXPECT_EQ(values(list), (std::vector<int>{10, 0, 9, 8, 7, 6, 5, 4, 1, 2, 3}));
+}
+
+TEST(ChunkedForwardList, EmplaceThatThrowsLeavesListUnchanged) {
+    chunkedForwardList<fragile, 2> list;
+    EXPECT_THROW(list.emplace_front(0, true), std::runtime_error);
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.chunk_count(), 0u);
+
+    list.emplace_front(2, false);
+    list.emplace_front(1, false);
+    EXPECT_THROW(list.emplace_after(list.cbegin(), 9, true), std::runtime_error);
+    EXPECT_THROW(list.emplace_front(9, true), std::runtime_error);
+    EXPECT_EQ(values(list), (std::vector<int>{1, 2}));
+    EXPECT_EQ(list.size(), 2u);
+    EXPECT_EQ(list.chunk_count(), 2u);
+}
+
+TEST(ChunkedForwardList, InsertCopyOfOwnElement) {
+    chunkedForwardList<std::string, 4> list;
+    list.push_front(std::string(40, 'a'));
+    for (int i = 0; i < 9; ++i) {
+        list.push_front(*list.begin());
+        list.insert_after(list.cbegin(), *list.begin());
+    }
+    EXPECT_EQ(contents(list), std::vector<std::string>(19, std::string(40, 'a')));
+}
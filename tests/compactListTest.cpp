@@ -0,0 +1,148 @@
+#include "../compactListHeader.hpp"
+#include "../nodePoolHeader.hpp"
+#include <gtest/gtest.h>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename List>
+std::vector<typename List::value_type> contents(List& list) {
+    std::vector<typename List::value_type> values;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        values.push_back(*it);
+    }
+    return values;
+}
+
+template <typename List>
+void randomEditsMatchStdList() {
+    std::mt19937 random(7);
+    List list;
+    std::list<int> reference;
+    for (int step = 0; step < 5000; ++step) {
+        if (reference.empty() || random() % 3 != 0) {
+            std::size_t position = random() % (reference.size() + 1);
+            int value = static_cast<int>(random() % 1000);
+            if (position == 0) {
+                list.push_front(value);
+                reference.push_front(value);
+                continue;
+            }
+            auto it = list.cbegin();
+            auto referenceIt = reference.begin();
+            for (std::size_t i = 1; i < position; ++i) {
+                ++it;
+                ++referenceIt;
+            }
+            list.insert_after(it, value);
+            reference.insert(std::next(referenceIt), value);
+        }
+        else if (reference.size() > 1) {
+            std::size_t position = random() % (reference.size() - 1);
+            auto it = list.cbegin();
+            auto referenceIt = reference.begin();
+            for (std::size_t i = 0; i < position; ++i) {
+                ++it;
+                ++referenceIt;
+            }
+            list.erase_after(it);
+            reference.erase(std::next(referenceIt));
+        }
+        if (step % 1000 == 999) {
+            list.compact();
+        }
+    }
+    EXPECT_EQ(list.size(), reference.size());
+    EXPECT_EQ(contents(list), std::vector<int>(reference.begin(), reference.end()));
+    list.push_back(-1);
+    EXPECT_EQ(contents(list).back(), -1);
+}
+
+} // namespace
+
+TEST(CompactForwardList, InsertAndEraseAfterMatchStdList) {
+    randomEditsMatchStdList<compactForwardList<int, nodeLayout::structOfArrays>>();
+    randomEditsMatchStdList<compactForwardList<int, nodeLayout::arrayOfStructs>>();
+}
+
+TEST(CompactForwardList, IteratorsSurviveGrowth) {
+    compactForwardList<std::string> list{"first"};
+    auto first = list.begin();
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(std::to_string(i));
+    }
+    EXPECT_GE(list.capacity(), 101u);
+    EXPECT_EQ(*first, "first");
+    list.push_back(*first);
+    EXPECT_EQ(contents(list).back(), "first");
+}
+
+TEST(CompactForwardList, CompactRenumbersIntoTraversalOrder) {
+    compactForwardList<std::string, nodeLayout::arrayOfStructs> list;
+    for (int i = 0; i < 50; ++i) {
+        list.push_front(std::to_string(i));
+    }
+    list.erase_after(list.cbegin());
+    std::vector<std::string> before = contents(list);
+    std::size_t capacity = list.capacity();
+
+    list.compact();
+    EXPECT_EQ(contents(list), before);
+    EXPECT_EQ(list.capacity(), capacity);
+    std::uint32_t slot = 0;
+    for (auto it = list.cbegin(); it != list.cend(); ++it) {
+        EXPECT_EQ(it.index, slot++);
+    }
+
+    list.shrink_to_fit();
+    EXPECT_EQ(list.capacity(), list.size());
+    EXPECT_EQ(contents(list), before);
+}
+
+TEST(CompactForwardList, ErasedSlotsAreReused) {
+    compactForwardList<int> list(16, 1);
+    EXPECT_EQ(list.capacity(), 16u);
+    for (int i = 0; i < 8; ++i) {
+        list.erase_after(list.cbegin());
+    }
+    for (int i = 0; i < 8; ++i) {
+        list.push_front(2);
+    }
+    EXPECT_EQ(list.size(), 16u);
+    EXPECT_EQ(list.capacity(), 16u);
+}
+
+TEST(CompactForwardList, CopyMoveAndClear) {
+    compactForwardList<int, nodeLayout::structOfArrays, poolAllocator<int>> list{1, 2, 3, 4};
+    compactForwardList<int, nodeLayout::structOfArrays, poolAllocator<int>> copy(list);
+    EXPECT_EQ(contents(copy), (std::vector<int>{1, 2, 3, 4}));
+
+    compactForwardList<int, nodeLayout::structOfArrays, poolAllocator<int>> moved(std::move(list));
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(moved.size(), 4u);
+
+    copy = moved;
+    moved = std::move(copy);
+    EXPECT_EQ(contents(moved), (std::vector<int>{1, 2, 3, 4}));
+
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(moved.capacity(), 0u);
+}
+
+TEST(CompactForwardList, EraseAfterEndThrows) {
+    compactForwardList<int> list;
+    list.push_front(1);
+    EXPECT_THROW(list.erase_after(list.cend()), std::invalid_argument);
+    EXPECT_THROW(list.reserve(std::size_t(1) << 33), std::length_error);
+}
+
+TEST(CompactForwardList, RangeConstructorNeedsIterators) {
+    using list = compactForwardList<std::string>;
+    EXPECT_FALSE((std::is_constructible<list, std::string, std::string>::value));
+    EXPECT_TRUE((std::is_constructible<list, const std::string*, const std::string*>::value));
+    EXPECT_TRUE(std::is_nothrow_move_constructible<list>::value);
+}
@@ -0,0 +1,83 @@
+#include "../concurrentListHeader.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace {
+
+template <typename List>
+std::vector<int> contents(const List& list) {
+    std::vector<int> values;
+    for (auto it = list.cbegin(); it != list.cend(); ++it) {
+        values.push_back(*it);
+    }
+    return values;
+}
+
+} // namespace
+
+TEST(ConcurrentForwardList, SingleThreadedOperations) {
+    concurrentForwardList<int> list;
+    EXPECT_TRUE(list.empty());
+    list.push_front(3);
+    list.push_front(1);
+    EXPECT_TRUE(list.insert_after(list.cbegin(), 2));
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(list.size(), 3u);
+
+    EXPECT_TRUE(list.erase_after(list.cbefore_begin()));
+    EXPECT_EQ(contents(list), (std::vector<int>{2, 3}));
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_FALSE(list.erase_after(list.cbefore_begin()));
+    EXPECT_THROW(list.insert_after(list.cend(), 0), std::invalid_argument);
+}
+
+TEST(ConcurrentForwardList, ConcurrentPushFrontKeepsEveryElement) {
+    concurrentForwardList<int> list;
+    const int threads = 4;
+    const int perThread = 5000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&list, t, perThread] {
+            for (int i = 0; i < perThread; ++i) {
+                list.push_front(t * perThread + i);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    std::vector<int> values = contents(list);
+    std::sort(values.begin(), values.end());
+    ASSERT_EQ(values.size(), static_cast<std::size_t>(threads * perThread));
+    for (int i = 0; i < threads * perThread; ++i) {
+        EXPECT_EQ(values[i], i);
+    }
+    EXPECT_EQ(list.size(), values.size());
+}
+
+TEST(ConcurrentForwardList, ConcurrentEraseRemovesEachElementOnce) {
+    concurrentForwardList<int> list;
+    for (int i = 0; i < 20000; ++i) {
+        list.push_front(i);
+    }
+    std::vector<int> erased(4, 0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&list, &erased, t] {
+            while (list.erase_after(list.cbefore_begin())) {
+                ++erased[t];
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(erased[0] + erased[1] + erased[2] + erased[3], 20000);
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.size(), 0u);
+}
@@ -0,0 +1,470 @@
+#include "../listHeader.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+template <typename List>
+std::vector<typename List::value_type> contents(List& list) {
+    std::vector<typename List::value_type> values;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        values.push_back(*it);
+    }
+    return values;
+}
+
+// Appends a marker at the back and checks it becomes the last element,
+// which verifies the cached tail
+template <typename List>
+void expectTailConsistent(List& list) {
+    std::size_t size = list.size();
+    list.push_back(-1);
+    std::vector<int> values = contents(list);
+    ASSERT_EQ(values.size(), size + 1);
+    EXPECT_EQ(values.back(), -1);
+    list.resize(size);
+}
+
+struct keyed {
+    int key;
+    int id;
+    bool operator==(const keyed& other) const { return key == other.key && id == other.id; }
+};
+
+struct byKey {
+    bool operator()(const keyed& lhs, const keyed& rhs) const { return lhs.key < rhs.key; }
+};
+
+// Element whose copy constructor throws once the shared budget of copies
+// runs out
+struct fragile {
+    static int copiesLeft;
+    int value;
+
+    fragile(int v) : value(v) { }
+    fragile(const fragile& other) : value(other.value) {
+        if (copiesLeft-- <= 0) {
+            throw std::runtime_error("copy failed");
+        }
+    }
+    bool operator==(const fragile& other) const { return value == other.value; }
+};
+
+int fragile::copiesLeft = 0;
+
+} // namespace
+
+TEST(ForwardList, StartsEmpty) {
+    forwardList<int> list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.size(), 0u);
+    EXPECT_EQ(list.begin(), list.end());
+}
+
+TEST(ForwardList, CountConstructors) {
+    forwardList<std::string> filled(3, "abc");
+    EXPECT_EQ(contents(filled), (std::vector<std::string>{"abc", "abc", "abc"}));
+
+    forwardList<int> defaulted(4);
+    EXPECT_EQ(contents(defaulted), (std::vector<int>{0, 0, 0, 0}));
+}
+
+TEST(ForwardList, RangeAndInitializerListConstructors) {
+    std::vector<int> values{1, 2, 3, 4};
+    forwardList<int> fromRange(values.begin(), values.end());
+    EXPECT_EQ(contents(fromRange), values);
+    EXPECT_EQ(fromRange.size(), 4u);
+    expectTailConsistent(fromRange);
+
+    forwardList<int> fromList{5, 6, 7};
+    EXPECT_EQ(contents(fromList), (std::vector<int>{5, 6, 7}));
+    expectTailConsistent(fromList);
+
+    // Single-pass input iterators work too
+    std::istringstream input("8 9 10");
+    forwardList<int> fromStream{std::istream_iterator<int>(input), std::istream_iterator<int>()};
+    EXPECT_EQ(contents(fromStream), (std::vector<int>{8, 9, 10}));
+
+    forwardList<int> counted(2, 9);
+    EXPECT_EQ(contents(counted), (std::vector<int>{9, 9}));
+}
+
+TEST(ForwardList, Assign) {
+    forwardList<int> list{1, 2, 3};
+    std::vector<int> values{4, 5};
+    list.assign(values.begin(), values.end());
+    EXPECT_EQ(contents(list), values);
+    expectTailConsistent(list);
+
+    list.assign(3, 7);
+    EXPECT_EQ(contents(list), (std::vector<int>{7, 7, 7}));
+
+    list = {1, 2};
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 2}));
+
+    list.assign(list.begin(), list.end());
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 2}));
+
+    list.assign(0, 1);
+    EXPECT_TRUE(list.empty());
+
+    std::istringstream input("6 7 8");
+    forwardList<int, poolAllocator<int>> pooled{1};
+    pooled.assign(std::istream_iterator<int>(input), std::istream_iterator<int>(), 3);
+    EXPECT_EQ(contents(pooled), (std::vector<int>{6, 7, 8}));
+    pooled.assign(values.begin(), values.end(), 10);
+    EXPECT_EQ(contents(pooled), values);
+    expectTailConsistent(pooled);
+}
+
+TEST(ForwardList, BulkOperationsRollBackOnFailure) {
+    fragile::copiesLeft = 100;
+    std::vector<fragile> values{1, 2, 3, 4};
+    forwardList<fragile> list(values.begin(), values.begin() + 3);
+    const std::vector<fragile> original{1, 2, 3};
+
+    fragile::copiesLeft = 2;
+    EXPECT_THROW(list.assign(values.begin(), values.end()), std::runtime_error);
+    fragile::copiesLeft = 100;
+    EXPECT_EQ(contents(list), original);
+
+    fragile::copiesLeft = 2;
+    EXPECT_THROW(list.insert_range_after(list.cbegin(), values.begin(), values.end()), std::runtime_error);
+    fragile::copiesLeft = 100;
+    EXPECT_EQ(contents(list), original);
+
+    fragile::copiesLeft = 1;
+    EXPECT_THROW(list.prepend_range(values.begin(), values.end()), std::runtime_error);
+    fragile::copiesLeft = 100;
+    EXPECT_EQ(contents(list), original);
+    EXPECT_EQ(list.size(), 3u);
+
+    fragile::copiesLeft = 0;
+    EXPECT_THROW((forwardList<fragile>(values.begin(), values.end())), std::runtime_error);
+}
+
+TEST(ForwardList, PushFrontAndBack) {
+    forwardList<int> list;
+    list.push_front(2);
+    list.push_front(1);
+    list.push_back(3);
+    list.emplace_back(4);
+    list.emplace_front(0);
+    EXPECT_EQ(contents(list), (std::vector<int>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(list.size(), 5u);
+    expectTailConsistent(list);
+}
+
+TEST(ForwardList, InsertAndEraseAfter) {
+    forwardList<int> list;
+    list.push_back(1);
+    list.push_back(3);
+    list.insert_after(list.begin().data, 2);
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 2, 3}));
+
+    list.erase_after((list.begin() + 1).data);
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 2}));
+    expectTailConsistent(list);
+
+    EXPECT_THROW(list.insert_after(nullptr, 0), std::invalid_argument);
+    EXPECT_THROW(list.erase_after(nullptr), std::invalid_argument);
+}
+
+TEST(ForwardList, EmplaceAfterReturnsNewElement) {
+    forwardList<int> list;
+    list.push_back(1);
+    auto it = list.emplace_after(list.begin(), 2);
+    it = list.emplace_after(it, 3);
+    EXPECT_EQ(*it, 3);
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 2, 3}));
+    expectTailConsistent(list);
+}
+
+TEST(ForwardList, InsertRangeAndPrependRange) {
+    std::vector<int> values{2, 3, 4};
+    forwardList<int> list;
+    list.push_back(1);
+    list.push_back(5);
+    auto last = list.insert_range_after(list.cbegin(), values.begin(), values.end());
+    EXPECT_EQ(*last, 4);
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 2, 3, 4, 5}));
+
+    std::vector<int> front{-1, 0};
+    auto first = list.prepend_range(front.begin(), front.end());
+    EXPECT_EQ(first, list.begin());
+    EXPECT_EQ(contents(list), (std::vector<int>{-1, 0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(list.size(), 7u);
+}
+
+TEST(ForwardList, Resize) {
+    forwardList<int> list;
+    list.resize(3, 7);
+    EXPECT_EQ(contents(list), (std::vector<int>{7, 7, 7}));
+    list.resize(1);
+    EXPECT_EQ(contents(list), (std::vector<int>{7}));
+    expectTailConsistent(list);
+    list.resize(0);
+    EXPECT_TRUE(list.empty());
+}
+
+TEST(ForwardList, CopyAndMove) {
+    forwardList<std::string> list;
+    list.push_back("a");
+    list.push_back("b");
+
+    forwardList<std::string> copy(list);
+    EXPECT_EQ(contents(copy), contents(list));
+
+    forwardList<std::string> assigned;
+    assigned.push_back("z");
+    assigned = list;
+    EXPECT_EQ(contents(assigned), contents(list));
+
+    forwardList<std::string> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(contents(moved), (std::vector<std::string>{"a", "b"}));
+
+    assigned = std::move(moved);
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(assigned.size(), 2u);
+}
+
+TEST(ForwardList, Swap) {
+    forwardList<int> a(2, 1);
+    forwardList<int> b(3, 2);
+    a.swap(b);
+    EXPECT_EQ(contents(a), (std::vector<int>{2, 2, 2}));
+    EXPECT_EQ(contents(b), (std::vector<int>{1, 1}));
+    expectTailConsistent(a);
+}
+
+TEST(ForwardList, SpliceWholeList) {
+    forwardList<int> list;
+    list.push_back(1);
+    list.push_back(4);
+    forwardList<int> other;
+    other.push_back(2);
+    other.push_back(3);
+    list.splice_after(list.begin(), other);
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(list.size(), 4u);
+}
+
+TEST(ForwardList, SpliceElementAndRange) {
+    forwardList<int> list;
+    list.push_back(1);
+    forwardList<int> other;
+    for (int value : {10, 20, 30, 40}) {
+        other.push_back(value);
+    }
+
+    list.splice_after(list.cbegin(), other, other.cbegin());
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 20}));
+    EXPECT_EQ(contents(other), (std::vector<int>{10, 30, 40}));
+
+    list.splice_after(list.cbegin(), other, other.cbegin(), other.cend());
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 30, 40, 20}));
+    EXPECT_EQ(contents(other), (std::vector<int>{10}));
+    EXPECT_EQ(list.size(), 4u);
+    EXPECT_EQ(other.size(), 1u);
+    expectTailConsistent(list);
+    expectTailConsistent(other);
+}
+
+TEST(ForwardList, Append) {
+    forwardList<int> list(2, 1);
+    forwardList<int> other(2, 2);
+    list.append(std::move(other));
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 1, 2, 2}));
+    expectTailConsistent(list);
+}
+
+TEST(ForwardList, MergeKeepsOrderAndIsStable) {
+    forwardList<keyed> list;
+    forwardList<keyed> other;
+    for (keyed value : {keyed{1, 0}, keyed{3, 1}, keyed{5, 2}}) {
+        list.push_back(value);
+    }
+    for (keyed value : {keyed{1, 3}, keyed{2, 4}, keyed{6, 5}}) {
+        other.push_back(value);
+    }
+
+    forwardList<keyed> copy(list);
+    copy.merge(other, byKey());
+    EXPECT_EQ(other.size(), 3u);
+
+    list.merge(std::move(other), byKey());
+    EXPECT_TRUE(other.empty());
+    std::vector<keyed> expected{{1, 0}, {1, 3}, {2, 4}, {3, 1}, {5, 2}, {6, 5}};
+    EXPECT_EQ(contents(list), expected);
+    EXPECT_EQ(contents(copy), expected);
+    EXPECT_EQ(list.size(), 6u);
+}
+
+TEST(ForwardList, MergeWithComparator) {
+    forwardList<int> list;
+    forwardList<int> other;
+    for (int value : {9, 5, 1}) {
+        list.push_back(value);
+    }
+    for (int value : {8, 2}) {
+        other.push_back(value);
+    }
+    list.merge(std::move(other), std::greater<int>());
+    EXPECT_EQ(contents(list), (std::vector<int>{9, 8, 5, 2, 1}));
+    expectTailConsistent(list);
+}
+
+TEST(ForwardList, SortIsStable) {
+    forwardList<keyed> list;
+    std::vector<keyed> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(keyed{(i * 7919) % 13, i});
+        list.push_back(values.back());
+    }
+    std::stable_sort(values.begin(), values.end(), byKey());
+    list.sort(byKey());
+    EXPECT_EQ(contents(list), values);
+    EXPECT_EQ(list.size(), values.size());
+}
+
+TEST(ForwardList, SortUpdatesTail) {
+    forwardList<int> list;
+    for (int value : {5, 3, 9, 1}) {
+        list.push_back(value);
+    }
+    list.sort();
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 3, 5, 9}));
+    expectTailConsistent(list);
+}
+
+TEST(ForwardList, ParallelSortMatchesSort) {
+    std::vector<keyed> values;
+    for (int i = 0; i < 200000; ++i) {
+        values.push_back(keyed{(i * 7919) % 1009, i});
+    }
+    forwardList<keyed> list(values.begin(), values.end());
+    std::stable_sort(values.begin(), values.end(), byKey());
+    list.parallel_sort(byKey(), 4);
+    EXPECT_EQ(contents(list), values);
+}
+
+TEST(ForwardList, UniqueRemoveAndReverse) {
+    forwardList<int> list;
+    for (int value : {1, 1, 2, 3, 3, 3, 4, 1}) {
+        list.push_back(value);
+    }
+    EXPECT_EQ(list.unique(), 3u);
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 2, 3, 4, 1}));
+
+    EXPECT_EQ(list.remove(1), 2u);
+    EXPECT_EQ(contents(list), (std::vector<int>{2, 3, 4}));
+
+    EXPECT_EQ(list.remove_if([](int value) { return value % 2 == 0; }), 2u);
+    EXPECT_EQ(contents(list), (std::vector<int>{3}));
+    expectTailConsistent(list);
+
+    list.push_back(4);
+    list.push_back(5);
+    list.reverse();
+    EXPECT_EQ(contents(list), (std::vector<int>{5, 4, 3}));
+    expectTailConsistent(list);
+}
+
+TEST(ForwardList, RemoveElementOfTheList) {
+    forwardList<std::string> list;
+    for (const char* value : {"a", "b", "a"}) {
+        list.push_back(value);
+    }
+    EXPECT_EQ(list.remove(*list.begin()), 2u);
+    EXPECT_EQ(contents(list), (std::vector<std::string>{"b"}));
+}
+
+TEST(ForwardList, ConstIteration) {
+    forwardList<int> list(3, 2);
+    const forwardList<int>& view = list;
+    int sum = 0;
+    for (auto it = view.cbegin(); it != view.cend(); ++it) {
+        sum += *it;
+    }
+    EXPECT_EQ(sum, 6);
+}
+
+TEST(PoolAllocator, ListsShareOnePool) {
+    poolAllocator<int> allocator;
+    forwardList<int, poolAllocator<int>> list(allocator);
+    forwardList<int, poolAllocator<int>> other(allocator);
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(i);
+        other.push_back(i + 100);
+    }
+    EXPECT_TRUE(list.get_allocator() == other.get_allocator());
+    list.append(std::move(other));
+    EXPECT_EQ(list.size(), 200u);
+    EXPECT_EQ(*(list.begin() + 150), 150);
+}
+
+TEST(PoolAllocator, ReserveTakesOneChunk) {
+    nodePool pool(sizeof(long), alignof(long), 4);
+    pool.reserve(100);
+    EXPECT_EQ(pool.chunk_count(), 1u);
+    std::vector<void*> blocks;
+    for (int i = 0; i < 100; ++i) {
+        blocks.push_back(pool.allocate());
+    }
+    EXPECT_EQ(pool.chunk_count(), 1u);
+    pool.reserve(3);
+    EXPECT_EQ(pool.chunk_count(), 2u);
+}
+
+TEST(PoolAllocator, CopiesFreeEachOthersBlocks) {
+    poolAllocator<long> allocator;
+    poolAllocator<double> rebound(allocator);
+    long* block = allocator.allocate(1);
+    poolAllocator<long> copy(rebound);
+    copy.deallocate(block, 1);
+    EXPECT_EQ(allocator.allocate(1), block);
+}
+
+TEST(PoolAllocator, BulkConstruction) {
+    std::vector<int> values(1000);
+    for (int i = 0; i < 1000; ++i) {
+        values[i] = i;
+    }
+    forwardList<int, poolAllocator<int>> list(values.begin(), values.end());
+    EXPECT_EQ(contents(list), values);
+    list.assign(10, 1);
+    EXPECT_EQ(contents(list), std::vector<int>(10, 1));
+}
+
+TEST(PoolAllocator, CopyGetsItsOwnPool) {
+    forwardList<int, poolAllocator<int>> list(10, 3);
+    forwardList<int, poolAllocator<int>> copy(list);
+    EXPECT_FALSE(list.get_allocator() == copy.get_allocator());
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(contents(copy), std::vector<int>(10, 3));
+}
+
+TEST(PoolAllocator, MergeAcrossPoolsMovesElements) {
+    forwardList<int, poolAllocator<int>> list;
+    forwardList<int, poolAllocator<int>> other;
+    for (int value : {1, 3}) {
+        list.push_back(value);
+    }
+    for (int value : {2, 4}) {
+        other.push_back(value);
+    }
+    list.merge(std::move(other));
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(contents(list), (std::vector<int>{1, 2, 3, 4}));
+}
@@ -0,0 +1,152 @@
+#include "../snapshotHeader.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct point {
+    double x;
+    std::int32_t id;
+};
+
+// Prefixed with the process id, so that test executables running side by
+// side do not share files
+std::string snapshotPath(const char* name) {
+    return (std::filesystem::temp_directory_path() / (std::to_string(::getpid()) + "-" + name)).string();
+}
+
+} // namespace
+
+TEST(Snapshot, SaveAndLoadRoundTrip) {
+    const std::string path = snapshotPath("forwardListSnapshotRoundTrip.bin");
+    forwardList<int> list{5, 3, 9, 1};
+    saveSnapshot(list, path);
+
+    forwardList<int> loaded{42};
+    loadSnapshot(loaded, path);
+    EXPECT_EQ(std::vector<int>(loaded.begin(), loaded.end()), (std::vector<int>{5, 3, 9, 1}));
+    EXPECT_EQ(loaded.size(), 4u);
+    std::remove(path.c_str());
+}
+
+TEST(Snapshot, ViewIteratesInPlace) {
+    const std::string path = snapshotPath("forwardListSnapshotView.bin");
+    forwardList<point> list;
+    for (int i = 0; i < 10000; ++i) {
+        list.push_back(point{i * 0.5, i});
+    }
+    saveSnapshot(list, path);
+
+    snapshotView<point> view(path);
+    EXPECT_EQ(view.size(), 10000u);
+    int expected = 0;
+    for (auto it = view.cbegin(); it != view.cend(); ++it, ++expected) {
+        EXPECT_EQ(it->id, expected);
+        EXPECT_EQ(it->x, expected * 0.5);
+    }
+    EXPECT_EQ(expected, 10000);
+
+    snapshotView<point> moved(std::move(view));
+    EXPECT_EQ(moved.cbegin()->id, 0);
+    std::remove(path.c_str());
+}
+
+TEST(Snapshot, MaterializeIntoPool) {
+    const std::string path = snapshotPath("forwardListSnapshotMaterialize.bin");
+    forwardList<long> list;
+    for (long i = 0; i < 1000; ++i) {
+        list.push_front(i);
+    }
+    saveSnapshot(list, path);
+
+    snapshotView<long> view(path);
+    forwardList<long, poolAllocator<long>> copy = view.materialize();
+    EXPECT_EQ(copy.size(), 1000u);
+    EXPECT_EQ(*copy.begin(), 999);
+    copy.push_front(1000);
+    EXPECT_EQ(copy.size(), 1001u);
+
+    forwardList<long> plain = view.materialize(std::allocator<long>());
+    EXPECT_TRUE(std::equal(plain.begin(), plain.end(), view.begin()));
+    std::remove(path.c_str());
+}
+
+TEST(Snapshot, EmptyList) {
+    const std::string path = snapshotPath("forwardListSnapshotEmpty.bin");
+    saveSnapshot(forwardList<int>(), path);
+    snapshotView<int> view(path);
+    EXPECT_TRUE(view.empty());
+    EXPECT_TRUE(view.cbegin() == view.cend());
+    EXPECT_TRUE(view.materialize().empty());
+    std::remove(path.c_str());
+}
+
+TEST(Snapshot, RejectsForeignFiles) {
+    const std::string path = snapshotPath("forwardListSnapshotForeign.bin");
+    saveSnapshot(forwardList<int>{1, 2, 3}, path);
+    EXPECT_THROW(snapshotView<double>{path}, std::runtime_error);
+
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << std::string(100, 'x');
+    EXPECT_THROW(snapshotView<int>{path}, std::runtime_error);
+    std::remove(path.c_str());
+    EXPECT_THROW(snapshotView<int>{path}, std::runtime_error);
+}
+
+TEST(Snapshot, PaddingIsWrittenAsZeros) {
+    const std::string path = snapshotPath("forwardListSnapshotPadding.bin");
+    saveSnapshot(forwardList<std::int32_t>{-1, -1}, path);
+    std::ifstream file(path, std::ios::binary);
+    std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    const std::uint64_t first = snapshotFirstRecord<std::int32_t>();
+    ASSERT_EQ(bytes.size(), first + 2 * sizeof(SnapshotRecord<std::int32_t>));
+    for (std::uint64_t record = first; record < bytes.size(); record += sizeof(SnapshotRecord<std::int32_t>)) {
+        for (std::size_t i = sizeof(std::int32_t); i < offsetof(SnapshotRecord<std::int32_t>, m_next); ++i) {
+            EXPECT_EQ(bytes[record + i], 0);
+        }
+    }
+    std::remove(path.c_str());
+}
+
+TEST(Snapshot, CorruptLinksThrow) {
+    const std::string path = snapshotPath("forwardListSnapshotCorrupt.bin");
+    const std::uint64_t first = snapshotFirstRecord<int>();
+    const std::uint64_t link = first + offsetof(SnapshotRecord<int>, m_next);
+    const auto patch = [&](std::uint64_t next) {
+        saveSnapshot(forwardList<int>{1, 2, 3}, path);
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(link));
+        file.write(reinterpret_cast<const char*>(&next), sizeof(next));
+    };
+
+    forwardList<int> list{7};
+    for (std::uint64_t next : {first, first + 1, first + 3 * sizeof(SnapshotRecord<int>), std::uint64_t(0)}) {
+        patch(next);
+        snapshotView<int> view(path);
+        EXPECT_THROW(view.materialize(), std::runtime_error);
+        EXPECT_THROW(loadSnapshot(list, path), std::runtime_error);
+        EXPECT_EQ(std::vector<int>(list.begin(), list.end()), std::vector<int>{7});
+    }
+    std::remove(path.c_str());
+}
+
+TEST(Snapshot, FailedSaveKeepsPreviousSnapshot) {
+    const std::string path = snapshotPath("forwardListSnapshotReplace.bin");
+    saveSnapshot(forwardList<int>{1, 2, 3}, path);
+    std::filesystem::create_directory(path + ".tmp");
+    EXPECT_THROW(saveSnapshot(forwardList<int>{4}, path), std::runtime_error);
+    std::filesystem::remove(path + ".tmp");
+
+    forwardList<int> loaded;
+    loadSnapshot(loaded, path);
+    EXPECT_EQ(std::vector<int>(loaded.begin(), loaded.end()), (std::vector<int>{1, 2, 3}));
+
+    saveSnapshot(forwardList<int>{4}, path);
+    loadSnapshot(loaded, path);
+    EXPECT_EQ(std::vector<int>(loaded.begin(), loaded.end()), std::vector<int>{4});
+    EXPECT_FALSE(std::filesystem::exists(path + ".tmp"));
+    std::remove(path.c_str());
+}